@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** CookedAssets
+*/
+
+#include "CookedAssets.hpp"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <cstring>
+
+static const char IMAGE_MAGIC[4] = {'S', 'K', 'T', 'X'};
+static const char WAVE_MAGIC[4] = {'S', 'K', 'S', 'N'};
+
+bool CookedAssets::Exists(const std::string &name)
+{
+    return std::filesystem::exists(GetPath(name));
+}
+
+bool CookedAssets::WriteBlob(const std::string &path, const char *magic, const uint32_t params[4],
+                             const void *data, uint64_t size)
+{
+    CookedBlobHeader header = {};
+    std::memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = VERSION;
+    std::memcpy(header.params, params, sizeof(header.params));
+    header.dataSize = size;
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not write cooked asset: " << path << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+    return static_cast<bool>(file);
+}
+
+void *CookedAssets::ReadBlob(const std::string &path, const char *magic, uint32_t params[4], uint64_t &size)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return nullptr;
+    CookedBlobHeader header;
+    if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, magic, sizeof(header.magic)) != 0 || header.version != VERSION) {
+        std::cerr << "Error: Stale or invalid cooked asset: " << path << std::endl;
+        return nullptr;
+    }
+    // raylib frees image and wave data with MemFree, so allocate with MemAlloc
+    void *data = MemAlloc(static_cast<unsigned int>(header.dataSize));
+    if (!data || !file.read(static_cast<char *>(data), static_cast<std::streamsize>(header.dataSize))) {
+        std::cerr << "Error: Truncated cooked asset: " << path << std::endl;
+        MemFree(data);
+        return nullptr;
+    }
+    std::memcpy(params, header.params, sizeof(header.params));
+    size = header.dataSize;
+    return data;
+}
+
+int CookedAssets::GetImageDataSize(int width, int height, int mipmaps, int format)
+{
+    int size = 0;
+    for (int level = 0; level < mipmaps; ++level) {
+        size += GetPixelDataSize(width, height, format);
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return size;
+}
+
+bool CookedAssets::WriteImage(const std::string &path, const Image &image)
+{
+    const uint32_t params[4] = {
+        static_cast<uint32_t>(image.width), static_cast<uint32_t>(image.height),
+        static_cast<uint32_t>(image.mipmaps), static_cast<uint32_t>(image.format)
+    };
+    int size = GetImageDataSize(image.width, image.height, image.mipmaps, image.format);
+    return WriteBlob(path, IMAGE_MAGIC, params, image.data, static_cast<uint64_t>(size));
+}
+
+bool CookedAssets::ReadImage(const std::string &path, Image &image)
+{
+    uint32_t params[4];
+    uint64_t size = 0;
+    void *data = ReadBlob(path, IMAGE_MAGIC, params, size);
+    if (!data)
+        return false;
+    int width = static_cast<int>(params[0]);
+    int height = static_cast<int>(params[1]);
+    int mipmaps = static_cast<int>(params[2]);
+    int format = static_cast<int>(params[3]);
+    if (mipmaps < 1 || static_cast<uint64_t>(GetImageDataSize(width, height, mipmaps, format)) != size) {
+        std::cerr << "Error: Cooked image size mismatch: " << path << std::endl;
+        MemFree(data);
+        return false;
+    }
+    image = {data, width, height, mipmaps, format};
+    return true;
+}
+
+bool CookedAssets::WriteWave(const std::string &path, const Wave &wave)
+{
+    const uint32_t params[4] = {wave.frameCount, wave.sampleRate, wave.sampleSize, wave.channels};
+    uint64_t size = static_cast<uint64_t>(wave.frameCount) * wave.channels * (wave.sampleSize / 8);
+    return WriteBlob(path, WAVE_MAGIC, params, wave.data, size);
+}
+
+bool CookedAssets::ReadWave(const std::string &path, Wave &wave)
+{
+    uint32_t params[4];
+    uint64_t size = 0;
+    void *data = ReadBlob(path, WAVE_MAGIC, params, size);
+    if (!data)
+        return false;
+    if (static_cast<uint64_t>(params[0]) * params[3] * (params[2] / 8) != size) {
+        std::cerr << "Error: Cooked sound size mismatch: " << path << std::endl;
+        MemFree(data);
+        return false;
+    }
+    wave = {params[0], params[1], params[2], params[3], data};
+    return true;
+}
+
+Sound CookedAssets::LoadSoundAsset(const std::string &name, bool &loaded)
+{
+    Wave wave;
+    if (ReadWave(GetPath(name + ".pcm"), wave)) {
+        Sound sound = LoadSoundFromWave(wave);
+        UnloadWave(wave);
+        loaded = true;
+        return sound;
+    }
+    std::string source = "assets/sounds/" + name + ".wav";
+    if (FileExists(source.c_str())) {
+        loaded = true;
+        return LoadSound(source.c_str());
+    }
+    loaded = false;
+    return Sound{};
+}
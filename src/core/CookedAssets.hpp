@@ -0,0 +1,47 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** CookedAssets
+*/
+
+#ifndef COOKEDASSETS_HPP_
+#define COOKEDASSETS_HPP_
+#pragma once
+
+#include <raylib.h>
+#include <string>
+#include <cstdint>
+
+// Runtime-ready blobs written by tools/AssetCooker ('make cook'). Images are
+// raw pixel data with every mip level, sounds are already-decoded PCM
+struct CookedBlobHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t params[4];
+    uint64_t dataSize;
+};
+
+class CookedAssets {
+private:
+    static bool WriteBlob(const std::string &path, const char *magic, const uint32_t params[4],
+                          const void *data, uint64_t size);
+    static void *ReadBlob(const std::string &path, const char *magic, uint32_t params[4], uint64_t &size);
+
+public:
+    static constexpr const char *DIRECTORY = "assets/cooked/";
+    static constexpr const char *LEVEL_PACK = "levels.pack";
+    static constexpr const char *TILE_ATLAS = "tile_atlas.tex";
+    static constexpr uint32_t VERSION = 1;
+
+    static std::string GetPath(const std::string &name) { return std::string(DIRECTORY) + name; }
+    static bool Exists(const std::string &name);
+    static int GetImageDataSize(int width, int height, int mipmaps, int format);
+    static bool WriteImage(const std::string &path, const Image &image);
+    static bool ReadImage(const std::string &path, Image &image);
+    static bool WriteWave(const std::string &path, const Wave &wave);
+    static bool ReadWave(const std::string &path, Wave &wave);
+    static Sound LoadSoundAsset(const std::string &name, bool &loaded);
+};
+
+#endif /* !COOKEDASSETS_HPP_ */
@@ -9,12 +9,17 @@
 #include "../screens/MenuScreen.hpp"
 #include "../screens/GameScreen.hpp"
 #include "../screens/PauseScreen.hpp"
+#include "../level/LevelIndex.hpp"
 #include <iostream>
 
 Game::Game()
     : currentState(GameState::MENU)
     , shouldClose(false)
     , deltaTime(0.0f)
+    , lastUpdateTime(0.0)
+    , lastDrawTime(0.0)
+    , forceRedraw(true)
+    , startLevel(0)
     , menuScreen(nullptr)
     , gameScreen(nullptr)
     , pauseScreen(nullptr) {
@@ -69,18 +74,60 @@ bool Game::Initialize()
 
 void Game::Run()
 {
+    lastUpdateTime = GetTime();
+    forceRedraw = true;
     while (!WindowShouldClose() && !shouldClose) {
-        deltaTime = GetFrameTime();
+        double now = GetTime();
+        deltaTime = static_cast<float>(now - lastUpdateTime);
+        lastUpdateTime = now;
+        LevelIndex::Update();
         UpdateCurrentScreen();
         HandleStateTransitions();
+        if (!ShouldRedraw(now)) {
+            // The last presented frame stays on screen, EndDrawing() is what
+            // normally polls input so it has to be done by hand here
+            WaitTime(config.idlePollInterval);
+            PollInputEvents();
+            continue;
+        }
         BeginDrawing();
         ClearBackground(DARKBLUE);
         DrawCurrentScreen();
         DrawFPS(10, 10);
         EndDrawing();
+        lastDrawTime = now;
+        forceRedraw = false;
     }
 }
 
+bool Game::CurrentScreenNeedsRedraw() const
+{
+    switch (currentState) {
+        case GameState::MENU:
+            return menuScreen && menuScreen->NeedsRedraw();
+        case GameState::PLAYING:
+        case GameState::LEVEL_COMPLETE:
+            return gameScreen && gameScreen->NeedsRedraw();
+        case GameState::PAUSED:
+            return (pauseScreen && pauseScreen->NeedsRedraw()) || (gameScreen && gameScreen->NeedsRedraw());
+        case GameState::GAME_OVER:
+            return false;
+    }
+    return true;
+}
+
+bool Game::ShouldRedraw(double now) const
+{
+    if (config.powerMode == PowerMode::PERFORMANCE || forceRedraw)
+        return true;
+    if (IsWindowResized())
+        return true;
+    // Ambient animations (title wobble, blinking caps) refresh at a low rate
+    if (now - lastDrawTime >= config.idleRedrawInterval)
+        return true;
+    return CurrentScreenNeedsRedraw();
+}
+
 void Game::Shutdown()
 {
     std::cout << "Shutting down game..." << std::endl;
@@ -116,8 +163,12 @@ void Game::ChangeState(GameState newState)
     if (currentState != newState) {
         GameState previousState = currentState;
         currentState = newState;
+        forceRedraw = true;
         switch (newState) {
             case GameState::MENU:
+                // Leaving a level is a natural pause, so that is when new
+                // best scores reach the disk
+                LevelIndex::Flush();
                 if (menuScreen) {
                     menuScreen->Reset();
                     menuScreen->PlayBackgroundMusic();
@@ -127,17 +178,22 @@ void Game::ChangeState(GameState newState)
                 if (menuScreen)
                     menuScreen->StopBackgroundMusic();
                 if (previousState == GameState::MENU && gameScreen)
-                    gameScreen->SetCurrentLevel(0);
+                    gameScreen->SetCurrentLevel(startLevel);
+                startLevel = 0;
                 break;
             case GameState::PAUSED:
                 if (pauseScreen)
                     pauseScreen->Show();
+                if (gameScreen)
+                    gameScreen->SetFrozen(true);
                 break;
             default:
                 break;
         }
         if (previousState == GameState::PAUSED && pauseScreen)
             pauseScreen->Hide();
+        if (previousState == GameState::PAUSED && gameScreen)
+            gameScreen->SetFrozen(false);
     }
 }
 
@@ -202,15 +258,18 @@ void Game::HandleStateTransitions()
     switch (currentState) {
         case GameState::MENU:
             if (menuScreen) {
-                if (menuScreen->IsOptionSelected()) {
+                int chosenLevel = menuScreen->TakeChosenLevel();
+                if (chosenLevel >= 0) {
+                    startLevel = chosenLevel;
+                    ChangeState(GameState::PLAYING);
+                } else if (!menuScreen->IsLevelSelectOpen() && menuScreen->IsOptionSelected()) {
                     MenuOption option = menuScreen->GetSelectedOption();
                     switch (option) {
                         case MenuOption::START_GAME:
                             ChangeState(GameState::PLAYING);
                             break;
                         case MenuOption::SELECT_LEVEL:
-                            // TODO: Implement level selection
-                            std::cout << "Level selection not implemented yet" << std::endl;
+                            menuScreen->OpenLevelSelect();
                             break;
                         case MenuOption::OPTIONS:
                             // TODO: Implement options menu
@@ -22,6 +22,10 @@ private:
     GameConfig config;
     bool shouldClose;
     float deltaTime;
+    double lastUpdateTime;
+    double lastDrawTime;
+    bool forceRedraw;
+    int startLevel;
 
     MenuScreen* menuScreen;
     GameScreen* gameScreen;
@@ -30,6 +34,8 @@ private:
     void UpdateCurrentScreen();
     void DrawCurrentScreen();
     void HandleStateTransitions();
+    bool CurrentScreenNeedsRedraw() const;
+    bool ShouldRedraw(double now) const;
     void CleanupScreens();
 
 public:
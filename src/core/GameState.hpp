@@ -17,6 +17,11 @@ enum class GameState {
     GAME_OVER
 };
 
+enum class PowerMode {
+    PERFORMANCE,
+    POWER_SAVER
+};
+
 struct GameConfig {
     int windowWidth = 1024;
     int windowHeight = 768;
@@ -35,6 +40,9 @@ struct GameConfig {
     bool showGrid = false;
     float inputDelay = 0.15f;
     bool allowDiagonalMovement = false;
+    PowerMode powerMode = PowerMode::PERFORMANCE;
+    float idleRedrawInterval = 0.5f;
+    float idlePollInterval = 1.0f / 30.0f;
 };
 
 inline const char* GameStateToString(GameState state)
@@ -0,0 +1,74 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelPreloader
+*/
+
+#include "LevelPreloader.hpp"
+#include "../level/LevelLoader.hpp"
+#include <iostream>
+#include <string>
+
+LevelPreloader::LevelPreloader()
+    : ready(false)
+    , pendingIndex(-1)
+    , succeeded(false) {
+}
+
+LevelPreloader::~LevelPreloader()
+{
+    Cancel();
+}
+
+void LevelPreloader::Request(int levelIndex)
+{
+    if (levelIndex == pendingIndex)
+        return;
+    Cancel();
+    if (levelIndex < 0 || levelIndex >= LevelLoader::GetTotalLevels())
+        return;
+    pendingIndex = levelIndex;
+    worker = std::thread(&LevelPreloader::Run, this, levelIndex);
+}
+
+void LevelPreloader::Run(int levelIndex)
+{
+    std::string buffer;
+    result.level = std::make_unique<Level>();
+    succeeded = LevelLoader::ReadLevel(*result.level, levelIndex, buffer);
+    if (succeeded) {
+        result.geometry = std::make_unique<StaticGeometry>();
+        result.geometry->Prepare(*result.level);
+    }
+    ready.store(true, std::memory_order_release);
+}
+
+bool LevelPreloader::Take(int levelIndex, PreloadedLevel &out)
+{
+    if (levelIndex != pendingIndex)
+        return false;
+    // Waiting here is never slower than loading synchronously
+    if (worker.joinable())
+        worker.join();
+    bool taken = succeeded;
+    if (taken)
+        out = std::move(result);
+    else
+        std::cerr << "Preloading level " << levelIndex << " failed, loading it synchronously" << std::endl;
+    Cancel();
+    return taken;
+}
+
+// Also releases an unused result; this has to happen on the main thread since
+// freeing meshes goes through the graphics API
+void LevelPreloader::Cancel()
+{
+    if (worker.joinable())
+        worker.join();
+    result.geometry.reset();
+    result.level.reset();
+    ready.store(false, std::memory_order_relaxed);
+    pendingIndex = -1;
+    succeeded = false;
+}
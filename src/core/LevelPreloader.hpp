@@ -0,0 +1,50 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelPreloader
+*/
+
+#ifndef LEVELPRELOADER_HPP_
+#define LEVELPRELOADER_HPP_
+#pragma once
+
+#include "../level/Level.hpp"
+#include "../graphics/StaticGeometry.hpp"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+struct PreloadedLevel {
+    std::unique_ptr<Level> level;
+    std::unique_ptr<StaticGeometry> geometry;
+};
+
+// Loads one level and builds its static meshes on a worker thread while the
+// current level is played. Everything except the GPU upload happens on the
+// worker, so switching levels is a pointer swap plus the upload.
+// Request/Take/Cancel must be called from the main thread
+class LevelPreloader {
+private:
+    std::thread worker;
+    std::atomic<bool> ready;
+    int pendingIndex;
+    bool succeeded;
+    PreloadedLevel result;
+
+    void Run(int levelIndex);
+
+public:
+    LevelPreloader();
+    ~LevelPreloader();
+    LevelPreloader(const LevelPreloader &) = delete;
+    LevelPreloader &operator=(const LevelPreloader &) = delete;
+
+    void Request(int levelIndex);
+    bool Take(int levelIndex, PreloadedLevel &out);
+    void Cancel();
+    bool IsReady() const { return ready.load(std::memory_order_acquire); }
+    int GetPendingIndex() const { return pendingIndex; }
+};
+
+#endif /* !LEVELPRELOADER_HPP_ */
@@ -0,0 +1,141 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelWatcher
+*/
+
+#include "LevelWatcher.hpp"
+#include "../level/LevelParser.hpp"
+#include <filesystem>
+#include <iostream>
+#include <vector>
+#ifdef __linux__
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+LevelWatcher::LevelWatcher()
+    : running(false)
+    , watchFd(-1)
+    , wakeFd(-1) {
+}
+
+LevelWatcher::~LevelWatcher()
+{
+    Stop();
+}
+
+#ifdef __linux__
+bool LevelWatcher::Start(const std::string &levelDirectory)
+{
+    Stop();
+    directory = levelDirectory;
+    watchFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    // Editors either rewrite the file in place or rename a temporary over it
+    if (watchFd < 0 || wakeFd < 0 ||
+        inotify_add_watch(watchFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        std::cerr << "Error: Could not watch level directory: " << directory << std::endl;
+        Stop();
+        return false;
+    }
+    running.store(true);
+    worker = std::thread(&LevelWatcher::Run, this);
+    std::cout << "Watching " << directory << " for level changes" << std::endl;
+    return true;
+}
+
+void LevelWatcher::Stop()
+{
+    running.store(false);
+    if (wakeFd >= 0) {
+        uint64_t one = 1;
+        if (write(wakeFd, &one, sizeof(one)) < 0)
+            std::cerr << "Error: Could not wake level watcher" << std::endl;
+    }
+    if (worker.joinable())
+        worker.join();
+    if (watchFd >= 0)
+        close(watchFd);
+    if (wakeFd >= 0)
+        close(wakeFd);
+    watchFd = -1;
+    wakeFd = -1;
+    std::lock_guard<std::mutex> lock(queueMutex);
+    reloads.clear();
+}
+
+void LevelWatcher::Run()
+{
+    alignas(struct inotify_event) char buffer[4096];
+    pollfd fds[2] = {{watchFd, POLLIN, 0}, {wakeFd, POLLIN, 0}};
+    std::vector<std::string> changed;
+    while (running.load()) {
+        if (poll(fds, 2, -1) < 0 || (fds[1].revents & POLLIN))
+            continue;
+        changed.clear();
+        ssize_t length;
+        while ((length = read(watchFd, buffer, sizeof(buffer))) > 0) {
+            for (char *ptr = buffer; ptr < buffer + length;) {
+                const inotify_event *event = reinterpret_cast<const inotify_event *>(ptr);
+                ptr += sizeof(inotify_event) + event->len;
+                if (event->len == 0 || std::filesystem::path(event->name).extension() != ".json")
+                    continue;
+                // One save often produces several events; parse each file once per batch
+                std::string path = (std::filesystem::path(directory) / event->name).string();
+                bool seen = false;
+                for (const auto &name : changed)
+                    seen = seen || name == path;
+                if (!seen)
+                    changed.push_back(path);
+            }
+        }
+        for (const auto &path : changed)
+            ReloadFile(path);
+    }
+}
+#else
+bool LevelWatcher::Start(const std::string &levelDirectory)
+{
+    directory = levelDirectory;
+    std::cout << "Level hot reload is not supported on this platform" << std::endl;
+    return false;
+}
+
+void LevelWatcher::Stop()
+{
+}
+
+void LevelWatcher::Run()
+{
+}
+#endif
+
+void LevelWatcher::ReloadFile(const std::string &path)
+{
+    std::string content;
+    if (!LevelParser::ReadFile(path, content))
+        return;
+    LevelReload reload;
+    reload.path = path;
+    reload.level = std::make_unique<Level>();
+    if (!reload.level->LoadFromJSON(content)) {
+        std::cerr << "Hot reload skipped, " << path << " does not parse: " << reload.level->GetLoadError() << std::endl;
+        return;
+    }
+    std::lock_guard<std::mutex> lock(queueMutex);
+    reloads.push_back(std::move(reload));
+}
+
+bool LevelWatcher::Poll(LevelReload &reload)
+{
+    std::lock_guard<std::mutex> lock(queueMutex);
+    if (reloads.empty())
+        return false;
+    reload = std::move(reloads.front());
+    reloads.pop_front();
+    return true;
+}
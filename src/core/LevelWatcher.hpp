@@ -0,0 +1,54 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelWatcher
+*/
+
+#ifndef LEVELWATCHER_HPP_
+#define LEVELWATCHER_HPP_
+#pragma once
+
+#include "../level/Level.hpp"
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+struct LevelReload {
+    std::string path;
+    std::unique_ptr<Level> level;
+};
+
+// Watches a level directory with inotify. The worker thread waits for
+// writes, re-parses the changed JSON file and queues the result; the game
+// only has to pick finished levels up with Poll(). A no-op on platforms
+// without inotify
+class LevelWatcher {
+private:
+    std::string directory;
+    std::thread worker;
+    std::atomic<bool> running;
+    std::mutex queueMutex;
+    std::deque<LevelReload> reloads;
+    int watchFd;
+    int wakeFd;
+
+    void Run();
+    void ReloadFile(const std::string &path);
+
+public:
+    LevelWatcher();
+    ~LevelWatcher();
+    LevelWatcher(const LevelWatcher &) = delete;
+    LevelWatcher &operator=(const LevelWatcher &) = delete;
+
+    bool Start(const std::string &levelDirectory);
+    void Stop();
+    bool Poll(LevelReload &reload);
+    bool IsRunning() const { return running.load(); }
+};
+
+#endif /* !LEVELWATCHER_HPP_ */
@@ -27,6 +27,7 @@ Box::Box()
     , bounceOffset(0.0f)
     , scaleMultiplier(1.0f)
     , currentTint(WHITE)
+    , lodLevel(LodLevel::HIGH)
     , currentLevel(nullptr)
     , animationManager(nullptr)
 {
@@ -47,7 +48,7 @@ void Box::Initialize(Vector3 startPos)
     UpdateTint();
 }
 
-void Box::Initialize(Vector2 gridPos, Level *level)
+void Box::Initialize(GridPos gridPos, Level *level)
 {
     currentLevel = level;
     gridPosition = gridPos;
@@ -101,6 +102,17 @@ void Box::UpdateVisualEffects(float deltaTime)
     UpdateTint();
 }
 
+bool Box::HasActiveEffects() const
+{
+    // The on-target pulse loops forever and is treated as ambient animation,
+    // only the fade back to rest after leaving a target counts as a change
+    if (isMoving)
+        return true;
+    if (state == BoxState::ON_TARGET)
+        return false;
+    return glowIntensity > 0.01f || fabsf(bounceOffset) > 0.001f || fabsf(scaleMultiplier - 1.0f) > 0.001f;
+}
+
 void Box::CompleteMovement()
 {
     isMoving = false;
@@ -119,7 +131,7 @@ void Box::CompleteMovement()
 void Box::CheckTargetStatus()
 {
     if (!currentLevel) return;
-    bool onTarget = currentLevel->IsTarget((int)gridPosition.x, (int)gridPosition.y);
+    bool onTarget = currentLevel->IsTarget(gridPosition);
     BoxState newState = onTarget ? BoxState::ON_TARGET : BoxState::NORMAL;
     if (newState != state) {
         SetState(newState);
@@ -162,7 +174,7 @@ void Box::UpdateTint()
     }
 }
 
-void Box::MoveTo(Vector2 newGridPos)
+void Box::MoveTo(GridPos newGridPos)
 {
     if (isMoving) {
         std::cout << "Box is already moving, cannot move!" << std::endl;
@@ -188,7 +200,7 @@ void Box::MoveTo(Vector2 newGridPos)
 
 void Box::MoveToWorld(Vector3 newWorldPos)
 {
-    Vector2 newGridPos = GetGridPositionFromWorld(newWorldPos);
+    GridPos newGridPos = GetGridPositionFromWorld(newWorldPos);
     MoveTo(newGridPos);
 }
 
@@ -200,7 +212,7 @@ void Box::SetPosition(Vector3 pos)
     CheckTargetStatus();
 }
 
-void Box::SetPositionImmediate(Vector2 newGridPos)
+void Box::SetPositionImmediate(GridPos newGridPos)
 {
     gridPosition = newGridPos;
     position = GetWorldPositionFromGrid(newGridPos);
@@ -211,7 +223,7 @@ void Box::SetPositionImmediate(Vector2 newGridPos)
     UpdateTint();
 }
 
-void Box::SetGridPosition(Vector2 gridPos)
+void Box::SetGridPosition(GridPos gridPos)
 {
     gridPosition = gridPos;
     position = GetWorldPositionFromGrid(gridPos);
@@ -219,7 +231,7 @@ void Box::SetGridPosition(Vector2 gridPos)
     CheckTargetStatus();
 }
 
-void Box::ForcePosition(Vector3 worldPos, Vector2 gridPos)
+void Box::ForcePosition(Vector3 worldPos, GridPos gridPos)
 {
     position = worldPos;
     targetPosition = worldPos;
@@ -258,49 +270,38 @@ bool Box::CanBePushed() const
     return !isMoving;
 }
 
-bool Box::CanMoveTo(Vector2 gridPos) const
+bool Box::CanMoveTo(GridPos gridPos) const
 {
     if (!currentLevel)
         return false;
-    int x = static_cast<int>(gridPos.x);
-    int y = static_cast<int>(gridPos.y);
-    bool validPos = currentLevel->IsValidPosition(x, y);
-    bool canMove = currentLevel->CanMoveToTile(x, y);
-    bool hasBox = currentLevel->HasBox(x, y);
-    return validPos && canMove && !hasBox;
+    return currentLevel->CanMoveToTile(gridPos);
 }
 
-bool Box::OnPushed(Vector2 direction)
+bool Box::OnPushed(Direction direction)
 {
-    Vector2 newGridPos = {
-        gridPosition.x + direction.x,
-        gridPosition.y + direction.y
-    };
+    GridPos newGridPos = Step(gridPosition, direction);
     if (!currentLevel) {
         std::cout << "No level reference!" << std::endl;
         return false;
     }
-    int newX = static_cast<int>(newGridPos.x);
-    int newY = static_cast<int>(newGridPos.y);
-    if (!currentLevel->IsValidPosition(newX, newY)) {
+    if (!currentLevel->IsValidPosition(newGridPos)) {
         std::cout << "New position out of bounds!" << std::endl;
         return false;
     }
-    if (currentLevel->GetTileType(newX, newY) == TileType::WALL) {
+    if (currentLevel->GetTileType(newGridPos.x, newGridPos.y) == TileType::WALL) {
         std::cout << "Cannot push box into wall!" << std::endl;
         return false;
     }
-    if (currentLevel->HasBox(newX, newY)) {
+    if (currentLevel->HasBox(newGridPos)) {
         std::cout << "Another box already at destination!" << std::endl;
         return false;
     }
-    currentLevel->RemoveBox(static_cast<int>(gridPosition.x), static_cast<int>(gridPosition.y));
+    currentLevel->MoveBox(gridPosition, newGridPos);
     Vector3 oldPos = position;
-    Vector3 newWorldPos = currentLevel->GridToWorld(newX, newY);
+    Vector3 newWorldPos = currentLevel->GridToWorld(newGridPos);
     gridPosition = newGridPos;
     position = newWorldPos;
     targetPosition = newWorldPos;
-    currentLevel->PlaceBox(newX, newY);
     if (animationDuration > 0.0f)
         StartMoveAnimation(oldPos, newWorldPos, animationDuration);
     CheckTargetStatus();
@@ -327,20 +328,20 @@ Vector3 Box::GetRenderScale() const
     return Vector3Scale(Vector3{1.0f, 1.0f, 1.0f}, scaleMultiplier);
 }
 
-Vector3 Box::GetWorldPositionFromGrid(Vector2 gridPos) const
+Vector3 Box::GetWorldPositionFromGrid(GridPos gridPos) const
 {
     if (currentLevel)
-        return currentLevel->GridToWorld(static_cast<int>(gridPos.x), static_cast<int>(gridPos.y));
+        return currentLevel->GridToWorld(gridPos);
     float tileSize = 1.0f;
     return { gridPos.x * tileSize, 0.0f, gridPos.y * tileSize };
 }
 
-Vector2 Box::GetGridPositionFromWorld(Vector3 worldPos) const
+GridPos Box::GetGridPositionFromWorld(Vector3 worldPos) const
 {
     if (currentLevel)
         return currentLevel->WorldToGrid(worldPos);
     float tileSize = 1.0f;
-    return { (float)(int)(worldPos.x / tileSize), (float)(int)(worldPos.z / tileSize) };
+    return { (int)std::lround(worldPos.x / tileSize), (int)std::lround(worldPos.z / tileSize) };
 }
 
 float Box::GetDistanceToTarget() const
@@ -366,4 +367,13 @@ void Box::LoadSaveData(const BoxSaveData& data)
 void Box::SetTargetPosition(Vector3 newTargetPos)
 {
     targetPosition = newTargetPos;
-}
\ No newline at end of file
+}
+void Box::SyncWithLevel(GridPos newGridPos, Vector3 newWorldPos)
+{
+    gridPosition = newGridPos;
+    position = newWorldPos;
+    targetPosition = newWorldPos;
+    isMoving = false;
+    animationTime = 0.0f;
+    CheckTargetStatus();
+}
@@ -11,6 +11,8 @@
 
 #include <raylib.h>
 #include <functional>
+#include "../graphics/LodSelector.hpp"
+#include "../level/GridPos.hpp"
 
 enum class BoxState {
     NORMAL,
@@ -26,7 +28,7 @@ class Box {
 private:
     Vector3 position;
     Vector3 targetPosition;
-    Vector2 gridPosition;
+    GridPos gridPosition;
     BoxState state;
     bool isMoving;
     float moveSpeed;
@@ -38,6 +40,7 @@ private:
     float bounceOffset;
     float scaleMultiplier;
     Color currentTint;
+    LodLevel lodLevel;
     Level *currentLevel;
     AnimationManager *animationManager;
     std::function<void()> onMoveComplete;
@@ -52,15 +55,15 @@ public:
     Box();
     ~Box();
     void Initialize(Vector3 startPos);
-    void Initialize(Vector2 gridPos, Level* level);
+    void Initialize(GridPos gridPos, Level* level);
     void Update(float deltaTime);
     void SetLevel(Level* level) { currentLevel = level; }
     void SetAnimationManager(AnimationManager* manager) { animationManager = manager; }
-    void MoveTo(Vector2 newGridPos);
+    void MoveTo(GridPos newGridPos);
     void MoveToWorld(Vector3 newWorldPos);
     void SetPosition(Vector3 pos);
-    void SetGridPosition(Vector2 gridPos);
-    void ForcePosition(Vector3 worldPos, Vector2 gridPos);
+    void SetGridPosition(GridPos gridPos);
+    void ForcePosition(Vector3 worldPos, GridPos gridPos);
     void StartMoveAnimation(Vector3 from, Vector3 to, float duration = 0.3f);
     void StartBounceAnimation(float intensity = 0.2f);
     void StartGlowAnimation();
@@ -68,30 +71,33 @@ public:
     BoxState GetState() const { return state; }
     void SetState(BoxState newState);
     Vector3 GetPosition() const { return position; }
-    Vector2 GetGridPosition() const { return gridPosition; }
+    GridPos GetGridPosition() const { return gridPosition; }
     bool IsMoving() const { return isMoving; }
+    bool HasActiveEffects() const;
     bool IsOnTarget() const { return state == BoxState::ON_TARGET; }
     bool CanBePushed() const;
-    bool CanMoveTo(Vector2 gridPos) const;
-    bool OnPushed(Vector2 direction);
+    bool CanMoveTo(GridPos gridPos) const;
+    bool OnPushed(Direction direction);
     void OnPlacedOnTarget();
     void OnRemovedFromTarget();
     float GetGlowIntensity() const { return glowIntensity; }
     float GetBounceOffset() const { return bounceOffset; }
     float GetScaleMultiplier() const { return scaleMultiplier; }
     Color GetCurrentTint() const { return currentTint; }
+    LodLevel GetLodLevel() const { return lodLevel; }
+    void SetLodLevel(LodLevel lod) { lodLevel = lod; }
     Vector3 GetRenderPosition() const;
     Vector3 GetRenderScale() const;
     void SetOnMoveCompleteCallback(std::function<void()> callback) { onMoveComplete = callback; }
     void SetOnStateChangedCallback(std::function<void(BoxState)> callback) { onStateChanged = callback; }
-    Vector3 GetWorldPositionFromGrid(Vector2 gridPos) const;
-    Vector2 GetGridPositionFromWorld(Vector3 worldPos) const;
+    Vector3 GetWorldPositionFromGrid(GridPos gridPos) const;
+    GridPos GetGridPositionFromWorld(Vector3 worldPos) const;
     float GetDistanceToTarget() const;
-    void SetPositionImmediate(Vector2 newGridPos);
+    void SetPositionImmediate(GridPos newGridPos);
     void SetTargetPosition(Vector3 newTargetPos);
-    void SyncWithLevel(Vector2 newGridPos, Vector3 newWorldPos);
+    void SyncWithLevel(GridPos newGridPos, Vector3 newWorldPos);
     struct BoxSaveData {
-        Vector2 gridPosition;
+        GridPos gridPosition;
         BoxState state;
     };
     BoxSaveData GetSaveData() const;
@@ -54,54 +54,49 @@ void Player::Update(float deltaTime)
 
 void Player::ProcessInput()
 {
-    Vector2 direction;
+    Direction direction;
     if (IsInputPressed(direction))
         TryMove(direction);
 }
 
-bool Player::IsInputPressed(Vector2 &outDirection)
+bool Player::IsInputPressed(Direction &outDirection)
 {
     if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
-        outDirection = {0, -1};
+        outDirection = Direction::UP;
         return true;
     }
     if (IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) {
-        outDirection = {0, 1};
+        outDirection = Direction::DOWN;
         return true;
     }
     if (IsKeyPressed(KEY_LEFT) || IsKeyPressed(KEY_A)) {
-        outDirection = {-1, 0};
+        outDirection = Direction::LEFT;
         return true;
     }
     if (IsKeyPressed(KEY_RIGHT) || IsKeyPressed(KEY_D)) {
-        outDirection = {1, 0};
+        outDirection = Direction::RIGHT;
         return true;
     }
     return false;
 }
 
-bool Player::TryMove(Vector2 direction)
+bool Player::TryMove(Direction direction)
 {
-    if (isMoving || !currentLevel)
+    if (isMoving || !currentLevel || direction == Direction::NONE)
         return false;
-    Vector2 newGridPos = {gridPosition.x + direction.x, gridPosition.y + direction.y};
-    if (!currentLevel->IsValidPosition((int)newGridPos.x, (int)newGridPos.y))
-        return false;
-    if (!currentLevel->CanMoveToTile((int)newGridPos.x, (int)newGridPos.y))
-        return false;
-    if (currentLevel->HasBox((int)newGridPos.x, (int)newGridPos.y)) {
-        Vector2 boxNewPos = {newGridPos.x + direction.x, newGridPos.y + direction.y};
-        if (!currentLevel->IsValidPosition((int)boxNewPos.x, (int)boxNewPos.y) ||
-            !currentLevel->CanMoveToTile((int)boxNewPos.x, (int)boxNewPos.y) ||
-            currentLevel->HasBox((int)boxNewPos.x, (int)boxNewPos.y)) {
+    GridPos newGridPos = Step(gridPosition, direction);
+    if (currentLevel->HasBox(newGridPos)) {
+        GridPos boxNewPos = Step(newGridPos, direction);
+        if (!currentLevel->CanMoveToTile(boxNewPos))
             return false;
-        }
-        currentLevel->MoveBox((int)newGridPos.x, (int)newGridPos.y, (int)boxNewPos.x, (int)boxNewPos.y);
+        currentLevel->MoveBox(newGridPos, boxNewPos);
         state = PlayerState::PUSHING;
         if (onBoxPushed)
             onBoxPushed(boxNewPos);
-    } else
+    } else if (currentLevel->CanMoveToTile(newGridPos))
         state = PlayerState::WALKING;
+    else
+        return false;
     rotation = CalculateRotationToDirection(direction);
     Vector3 fromPos = position;
     Vector3 toPos = GetWorldPositionFromGrid(newGridPos);
@@ -113,20 +108,20 @@ bool Player::TryMove(Vector2 direction)
 
 bool Player::TryMoveWithInput()
 {
-    Vector2 direction = GetDirectionFromInput();
-    if (direction.x == 0 && direction.y == 0) {
+    Direction direction = GetDirectionFromInput();
+    if (direction == Direction::NONE) {
         return false;
     }
     return TryMove(direction);
 }
 
-Vector2 Player::GetDirectionFromInput()
+Direction Player::GetDirectionFromInput()
 {
-    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) return {0, -1};
-    if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S)) return {0, 1};
-    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) return {-1, 0};
-    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) return {1, 0};
-    return {0, 0};
+    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) return Direction::UP;
+    if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S)) return Direction::DOWN;
+    if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) return Direction::LEFT;
+    if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) return Direction::RIGHT;
+    return Direction::NONE;
 }
 
 void Player::StartMoveAnimation(Vector3 from, Vector3 to, float duration)
@@ -183,14 +178,14 @@ void Player::SetPosition(Vector3 pos)
     gridPosition = GetGridPositionFromWorld(pos);
 }
 
-void Player::SetGridPosition(Vector2 gridPos)
+void Player::SetGridPosition(GridPos gridPos)
 {
     gridPosition = gridPos;
     position = GetWorldPositionFromGrid(gridPos);
     targetPosition = position;
 }
 
-void Player::ForcePosition(Vector3 worldPos, Vector2 gridPos)
+void Player::ForcePosition(Vector3 worldPos, GridPos gridPos)
 {
     position = worldPos;
     targetPosition = worldPos;
@@ -199,34 +194,27 @@ void Player::ForcePosition(Vector3 worldPos, Vector2 gridPos)
     state = PlayerState::IDLE;
 }
 
-float Player::CalculateRotationToDirection(Vector2 direction)
+float Player::CalculateRotationToDirection(Direction direction)
 {
-    if (direction.x > 0) return 90.0f;
-    if (direction.x < 0) return -90.0f;
-    if (direction.y > 0) return 180.0f;
-    if (direction.y < 0) return 0.0f;
-    return rotation;
+    if (direction == Direction::NONE)
+        return rotation;
+    return DIRECTION_ROTATIONS[static_cast<int>(direction)];
 }
 
-bool Player::CanMoveInDirection(Vector2 direction)
+bool Player::CanMoveInDirection(Direction direction)
 {
     if (!currentLevel || isMoving)
         return false;
-    Vector2 newPos = {gridPosition.x + direction.x, gridPosition.y + direction.y};
-    return currentLevel->IsValidPosition((int)newPos.x, (int)newPos.y) &&
-           currentLevel->CanMoveToTile((int)newPos.x, (int)newPos.y);
+    return currentLevel->CanMoveToTile(Step(gridPosition, direction));
 }
 
-bool Player::CanPushBoxInDirection(Vector2 direction)
+bool Player::CanPushBoxInDirection(Direction direction)
 {
     if (!currentLevel || isMoving)
         return false;
-    Vector2 boxPos = {gridPosition.x + direction.x, gridPosition.y + direction.y};
-    Vector2 boxNewPos = {boxPos.x + direction.x, boxPos.y + direction.y};
-    return currentLevel->HasBox((int)boxPos.x, (int)boxPos.y) &&
-           currentLevel->IsValidPosition((int)boxNewPos.x, (int)boxNewPos.y) &&
-           currentLevel->CanMoveToTile((int)boxNewPos.x, (int)boxNewPos.y) &&
-           !currentLevel->HasBox((int)boxNewPos.x, (int)boxNewPos.y);
+    GridPos boxPos = Step(gridPosition, direction);
+    return currentLevel->HasBox(boxPos) &&
+           currentLevel->CanMoveToTile(Step(boxPos, direction));
 }
 
 bool Player::CanPush() const
@@ -259,29 +247,29 @@ void Player::StopAnimation()
     StopMovement();
 }
 
-Vector3 Player::GetWorldPositionFromGrid(Vector2 gridPos) const
+Vector3 Player::GetWorldPositionFromGrid(GridPos gridPos) const
 {
     if (currentLevel)
-        return currentLevel->GridToWorld((int)gridPos.x, (int)gridPos.y);
-    return {gridPos.x, 0.0f, gridPos.y};
+        return currentLevel->GridToWorld(gridPos);
+    return {(float)gridPos.x, 0.0f, (float)gridPos.y};
 }
 
-Vector2 Player::GetGridPositionFromWorld(Vector3 worldPos) const
+GridPos Player::GetGridPositionFromWorld(Vector3 worldPos) const
 {
     if (currentLevel)
         return currentLevel->WorldToGrid(worldPos);
-    return {worldPos.x, worldPos.z};
+    return {(int)std::lround(worldPos.x), (int)std::lround(worldPos.z)};
 }
 
-Vector2 Player::GetFacingDirection() const
+Direction Player::GetFacingDirection() const
 {
     if (rotation >= -45.0f && rotation < 45.0f)
-        return {0, -1};
+        return Direction::UP;
     if (rotation >= 45.0f && rotation < 135.0f)
-        return {1, 0};
+        return Direction::RIGHT;
     if (rotation >= 135.0f || rotation < -135.0f)
-        return {0, 1};
-    return {-1, 0};
+        return Direction::DOWN;
+    return Direction::LEFT;
 }
 
 void DrawText3D(const char* text, Vector3 position, float fontSize, Color color, const Camera3D& camera)
@@ -11,6 +11,7 @@
 
 #include <raylib.h>
 #include <functional>
+#include "../level/GridPos.hpp"
 
 enum class PlayerState {
     IDLE,
@@ -25,7 +26,7 @@ class Player {
 private:
     Vector3 position;
     Vector3 targetPosition;
-    Vector2 gridPosition;
+    GridPos gridPosition;
     float rotation;
     PlayerState state;
     float moveSpeed;
@@ -37,13 +38,13 @@ private:
     Level *currentLevel;
     AnimationManager* animationManager;
     std::function<void()> onMoveComplete;
-    std::function<void(Vector2)> onBoxPushed;
+    std::function<void(GridPos)> onBoxPushed;
     void UpdateAnimation(float deltaTime);
     void CompleteMovement();
-    float CalculateRotationToDirection(Vector2 direction);
-    Vector2 GetDirectionFromInput();
-    bool CanMoveInDirection(Vector2 direction);
-    bool CanPushBoxInDirection(Vector2 direction);
+    float CalculateRotationToDirection(Direction direction);
+    Direction GetDirectionFromInput();
+    bool CanMoveInDirection(Direction direction);
+    bool CanPushBoxInDirection(Direction direction);
 
 public:
     Player();
@@ -52,18 +53,18 @@ public:
     void Update(float deltaTime);
     void SetLevel(Level* level) { currentLevel = level; }
     void SetAnimationManager(AnimationManager* manager) { animationManager = manager; }
-    bool TryMove(Vector2 direction);
+    bool TryMove(Direction direction);
     bool TryMoveWithInput();
     void SetPosition(Vector3 pos);
-    void SetGridPosition(Vector2 gridPos);
-    void ForcePosition(Vector3 worldPos, Vector2 gridPos);
+    void SetGridPosition(GridPos gridPos);
+    void ForcePosition(Vector3 worldPos, GridPos gridPos);
     void StartMoveAnimation(Vector3 from, Vector3 to, float duration = 0.3f);
     void StartPushAnimation(Vector3 from, Vector3 to, float duration = 0.4f);
     void StopAnimation();
     PlayerState GetState() const { return state; }
     void SetState(PlayerState newState) { state = newState; }
     Vector3 GetPosition() const { return position; }
-    Vector2 GetGridPosition() const { return gridPosition; }
+    GridPos GetGridPosition() const { return gridPosition; }
     float GetRotation() const { return rotation; }
     bool IsMoving() const { return isMoving; }
     bool CanPush() const;
@@ -71,12 +72,12 @@ public:
     void StartPushInteraction();
     void StopMovement();
     void SetOnMoveCompleteCallback(std::function<void()> callback) { onMoveComplete = callback; }
-    void SetOnBoxPushedCallback(std::function<void(Vector2)> callback) { onBoxPushed = callback; }
+    void SetOnBoxPushedCallback(std::function<void(GridPos)> callback) { onBoxPushed = callback; }
     void ProcessInput();
-    bool IsInputPressed(Vector2 &outDirection);
-    Vector3 GetWorldPositionFromGrid(Vector2 gridPos) const;
-    Vector2 GetGridPositionFromWorld(Vector3 worldPos) const;
-    Vector2 GetFacingDirection() const;
+    bool IsInputPressed(Direction &outDirection);
+    Vector3 GetWorldPositionFromGrid(GridPos gridPos) const;
+    GridPos GetGridPositionFromWorld(Vector3 worldPos) const;
+    Direction GetFacingDirection() const;
 };
 
 #endif /* !PLAYER_HPP_ */
\ No newline at end of file
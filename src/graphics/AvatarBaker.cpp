@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** AvatarBaker
+*/
+
+#include "AvatarBaker.hpp"
+#include "MeshBuilder.hpp"
+#include <iostream>
+
+void AvatarBaker::AddPlayer(MeshBuilder &builder, LodLevel lod)
+{
+    // Local space: feet on y = 0, facing +Z, rotated as a whole at draw time
+    Color workSuitColor = {70, 120, 180, 255};
+    Color darkWorkSuit = {50, 90, 140, 255};
+    Color helmetColor = {255, 220, 0, 255};
+    builder.AddCuboid({0.0f, 0.5f, 0.0f}, {0.6f, 0.8f, 0.4f}, workSuitColor);
+    if (lod == LodLevel::LOW) {
+        builder.AddSphere({0.0f, 1.05f, 0.0f}, 0.24f, 4, 6, helmetColor);
+        return;
+    }
+    builder.AddCuboid({-0.15f, 0.2f, 0.0f}, {0.25f, 0.6f, 0.25f}, darkWorkSuit);
+    builder.AddCuboid({0.15f, 0.2f, 0.0f}, {0.25f, 0.6f, 0.25f}, darkWorkSuit);
+    builder.AddCuboid({-0.35f, 0.6f, 0.0f}, {0.25f, 0.5f, 0.25f}, workSuitColor);
+    builder.AddCuboid({0.35f, 0.6f, 0.0f}, {0.25f, 0.5f, 0.25f}, workSuitColor);
+    int rings = lod == LodLevel::HIGH ? 16 : 8;
+    builder.AddSphere({0.0f, 1.0f, 0.0f}, 0.2f, rings, rings, {220, 180, 140, 255});
+    builder.AddSphere({0.0f, 1.05f, 0.0f}, 0.24f, rings, rings, helmetColor);
+    if (lod == LodLevel::MEDIUM)
+        return;
+    Color white = {255, 255, 255, 255};
+    Color strapColor = {80, 80, 80, 255};
+    Color shoeColor = {40, 30, 20, 255};
+    Color metalColor = {120, 120, 130, 255};
+    builder.AddCuboid({0.0f, 1.02f, 0.22f}, {0.35f, 0.08f, 0.04f}, {200, 170, 0, 255});
+    builder.AddCylinder({0.0f, 0.95f, 0.0f}, 0.25f, 0.03f, 8, white);
+    builder.AddCuboid({-0.18f, 0.9f, 0.0f}, {0.02f, 0.15f, 0.02f}, strapColor);
+    builder.AddCuboid({0.18f, 0.9f, 0.0f}, {0.02f, 0.15f, 0.02f}, strapColor);
+    builder.AddCuboid({-0.15f, 0.05f, 0.1f}, {0.3f, 0.15f, 0.4f}, shoeColor);
+    builder.AddCuboid({0.15f, 0.05f, 0.1f}, {0.3f, 0.15f, 0.4f}, shoeColor);
+    builder.AddCuboid({-0.15f, 0.08f, 0.2f}, {0.25f, 0.06f, 0.15f}, metalColor);
+    builder.AddCuboid({0.15f, 0.08f, 0.2f}, {0.25f, 0.06f, 0.15f}, metalColor);
+    builder.AddCuboid({0.0f, 0.7f, 0.35f}, {0.5f, 0.05f, 0.01f}, white);
+    builder.AddCuboid({0.0f, 0.4f, 0.35f}, {0.5f, 0.05f, 0.01f}, white);
+    builder.AddCuboid({-0.25f, 0.65f, 0.35f}, {0.08f, 0.12f, 0.01f}, white);
+    builder.AddCuboid({-0.25f, 0.65f, 0.356f}, {0.06f, 0.1f, 0.012f}, {200, 50, 50, 255});
+}
+
+bool AvatarBaker::ExportPlayer(const Mesh &mesh, LodLevel lod, const std::string &directory)
+{
+    if (!DirectoryExists(directory.c_str())) {
+        std::cerr << "Mesh export directory not found: " << directory << std::endl;
+        return false;
+    }
+    std::string path = directory + "/player_lod" + std::to_string(static_cast<int>(lod)) + ".obj";
+    if (!ExportMesh(mesh, path.c_str())) {
+        std::cerr << "Failed to export player mesh: " << path << std::endl;
+        return false;
+    }
+    std::cout << "Player mesh exported to " << path << std::endl;
+    return true;
+}
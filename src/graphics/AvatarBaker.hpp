@@ -0,0 +1,24 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** AvatarBaker
+*/
+
+#ifndef AVATARBAKER_HPP_
+#define AVATARBAKER_HPP_
+#pragma once
+
+#include <raylib.h>
+#include <string>
+#include "LodSelector.hpp"
+
+class MeshBuilder;
+
+class AvatarBaker {
+public:
+    static void AddPlayer(MeshBuilder &builder, LodLevel lod = LodLevel::HIGH);
+    static bool ExportPlayer(const Mesh &mesh, LodLevel lod, const std::string &directory);
+};
+
+#endif /* !AVATARBAKER_HPP_ */
@@ -0,0 +1,151 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** FrameBackdrop
+*/
+
+#include "FrameBackdrop.hpp"
+#include <rlgl.h>
+#include <iostream>
+
+static const char *BLUR_FS = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+uniform sampler2D texture0;
+uniform vec2 direction;
+out vec4 finalColor;
+void main()
+{
+    vec3 sum = texture(texture0, fragTexCoord).rgb * 0.2270270270;
+    sum += texture(texture0, fragTexCoord + direction * 1.3846153846).rgb * 0.3162162162;
+    sum += texture(texture0, fragTexCoord - direction * 1.3846153846).rgb * 0.3162162162;
+    sum += texture(texture0, fragTexCoord + direction * 3.2307692308).rgb * 0.0702702703;
+    sum += texture(texture0, fragTexCoord - direction * 3.2307692308).rgb * 0.0702702703;
+    finalColor = vec4(sum, 1.0);
+}
+)";
+
+FrameBackdrop::FrameBackdrop()
+    : capture()
+    , scratch()
+    , blurShader()
+    , directionLoc(-1)
+    , targetsLoaded(false)
+    , shaderLoaded(false)
+    , valid(false)
+{
+}
+
+FrameBackdrop::~FrameBackdrop()
+{
+    Shutdown();
+}
+
+bool FrameBackdrop::Initialize()
+{
+    blurShader = LoadShaderFromMemory(nullptr, BLUR_FS);
+    if (blurShader.id == 0 || blurShader.id == rlGetShaderIdDefault()) {
+        std::cerr << "Backdrop blur shader unavailable, overlays use a sharp backdrop" << std::endl;
+        return false;
+    }
+    directionLoc = GetShaderLocation(blurShader, "direction");
+    shaderLoaded = true;
+    return true;
+}
+
+void FrameBackdrop::Shutdown()
+{
+    UnloadTargets();
+    if (shaderLoaded) {
+        UnloadShader(blurShader);
+        shaderLoaded = false;
+    }
+}
+
+bool FrameBackdrop::LoadTargets(int width, int height)
+{
+    UnloadTargets();
+    capture = LoadRenderTexture(width, height);
+    scratch = LoadRenderTexture(width, height);
+    if (capture.id == 0 || scratch.id == 0) {
+        std::cerr << "Failed to create backdrop render textures" << std::endl;
+        UnloadRenderTexture(capture);
+        UnloadRenderTexture(scratch);
+        return false;
+    }
+    SetTextureFilter(capture.texture, TEXTURE_FILTER_BILINEAR);
+    SetTextureFilter(scratch.texture, TEXTURE_FILTER_BILINEAR);
+    targetsLoaded = true;
+    return true;
+}
+
+void FrameBackdrop::UnloadTargets()
+{
+    if (targetsLoaded) {
+        UnloadRenderTexture(capture);
+        UnloadRenderTexture(scratch);
+        capture = {};
+        scratch = {};
+        targetsLoaded = false;
+    }
+    valid = false;
+}
+
+bool FrameBackdrop::IsValid() const
+{
+    return valid && targetsLoaded
+        && capture.texture.width == GetScreenWidth()
+        && capture.texture.height == GetScreenHeight();
+}
+
+bool FrameBackdrop::BeginCapture()
+{
+    int width = GetScreenWidth();
+    int height = GetScreenHeight();
+    if (width <= 0 || height <= 0)
+        return false;
+    if (!targetsLoaded || capture.texture.width != width || capture.texture.height != height) {
+        if (!LoadTargets(width, height))
+            return false;
+    }
+    valid = false;
+    BeginTextureMode(capture);
+    return true;
+}
+
+void FrameBackdrop::BlurPass(const RenderTexture2D &source, const RenderTexture2D &destination, Vector2 direction)
+{
+    float width = static_cast<float>(source.texture.width);
+    float height = static_cast<float>(source.texture.height);
+    BeginTextureMode(destination);
+    BeginShaderMode(blurShader);
+    SetShaderValue(blurShader, directionLoc, &direction, SHADER_UNIFORM_VEC2);
+    DrawTextureRec(source.texture, {0.0f, 0.0f, width, -height}, {0.0f, 0.0f}, WHITE);
+    EndShaderMode();
+    EndTextureMode();
+}
+
+void FrameBackdrop::EndCapture(bool blur)
+{
+    EndTextureMode();
+    valid = true;
+    if (!blur || !shaderLoaded)
+        return;
+    // Separable gaussian, ping-ponged so the result always ends in capture
+    float texelX = BLUR_SPREAD / capture.texture.width;
+    float texelY = BLUR_SPREAD / capture.texture.height;
+    for (int i = 0; i < BLUR_PASSES; i++) {
+        BlurPass(capture, scratch, {texelX, 0.0f});
+        BlurPass(scratch, capture, {0.0f, texelY});
+    }
+}
+
+void FrameBackdrop::Draw() const
+{
+    if (!valid || !targetsLoaded)
+        return;
+    float width = static_cast<float>(capture.texture.width);
+    float height = static_cast<float>(capture.texture.height);
+    DrawTextureRec(capture.texture, {0.0f, 0.0f, width, -height}, {0.0f, 0.0f}, WHITE);
+}
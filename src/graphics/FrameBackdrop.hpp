@@ -0,0 +1,41 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** FrameBackdrop
+*/
+
+#ifndef FRAMEBACKDROP_HPP_
+#define FRAMEBACKDROP_HPP_
+#pragma once
+
+#include <raylib.h>
+
+class FrameBackdrop {
+private:
+    static constexpr float BLUR_SPREAD = 2.0f;
+    static constexpr int BLUR_PASSES = 2;
+    RenderTexture2D capture;
+    RenderTexture2D scratch;
+    Shader blurShader;
+    int directionLoc;
+    bool targetsLoaded;
+    bool shaderLoaded;
+    bool valid;
+    bool LoadTargets(int width, int height);
+    void UnloadTargets();
+    void BlurPass(const RenderTexture2D &source, const RenderTexture2D &destination, Vector2 direction);
+
+public:
+    FrameBackdrop();
+    ~FrameBackdrop();
+    bool Initialize();
+    void Shutdown();
+    bool IsValid() const;
+    void Invalidate() { valid = false; }
+    bool BeginCapture();
+    void EndCapture(bool blur);
+    void Draw() const;
+};
+
+#endif /* !FRAMEBACKDROP_HPP_ */
@@ -0,0 +1,77 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** Frustum
+*/
+
+#include "Frustum.hpp"
+#include <raymath.h>
+#include <rlgl.h>
+#include <cmath>
+
+Frustum::Frustum()
+{
+    for (FrustumPlane &plane : planes)
+        plane = {{0.0f, 0.0f, 0.0f}, 0.0f};
+}
+
+void Frustum::SetPlane(int index, float a, float b, float c, float d)
+{
+    float length = sqrtf(a * a + b * b + c * c);
+    if (length <= 0.0f)
+        length = 1.0f;
+    planes[index].normal = {a / length, b / length, c / length};
+    planes[index].distance = d / length;
+}
+
+void Frustum::Extract(const Camera3D &camera, float aspect)
+{
+    // Same projection BeginMode3D() builds, so culling matches what is rasterized
+    Matrix projection;
+    if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+        double top = camera.fovy / 2.0;
+        double right = top * aspect;
+        projection = MatrixOrtho(-right, right, -top, top, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    } else {
+        projection = MatrixPerspective(camera.fovy * DEG2RAD, aspect, RL_CULL_DISTANCE_NEAR, RL_CULL_DISTANCE_FAR);
+    }
+    Matrix m = MatrixMultiply(GetCameraMatrix(camera), projection);
+    SetPlane(0, m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8, m.m15 + m.m12);
+    SetPlane(1, m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8, m.m15 - m.m12);
+    SetPlane(2, m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9, m.m15 + m.m13);
+    SetPlane(3, m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9, m.m15 - m.m13);
+    SetPlane(4, m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10, m.m15 + m.m14);
+    SetPlane(5, m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10, m.m15 - m.m14);
+}
+
+FrustumTest Frustum::TestBox(const BoundingBox &box) const
+{
+    FrustumTest result = FrustumTest::INSIDE;
+    for (const FrustumPlane &plane : planes) {
+        Vector3 positive = {
+            plane.normal.x >= 0.0f ? box.max.x : box.min.x,
+            plane.normal.y >= 0.0f ? box.max.y : box.min.y,
+            plane.normal.z >= 0.0f ? box.max.z : box.min.z
+        };
+        if (Vector3DotProduct(plane.normal, positive) + plane.distance < 0.0f)
+            return FrustumTest::OUTSIDE;
+        Vector3 negative = {
+            plane.normal.x >= 0.0f ? box.min.x : box.max.x,
+            plane.normal.y >= 0.0f ? box.min.y : box.max.y,
+            plane.normal.z >= 0.0f ? box.min.z : box.max.z
+        };
+        if (Vector3DotProduct(plane.normal, negative) + plane.distance < 0.0f)
+            result = FrustumTest::INTERSECT;
+    }
+    return result;
+}
+
+bool Frustum::IsSphereVisible(Vector3 center, float radius) const
+{
+    for (const FrustumPlane &plane : planes) {
+        if (Vector3DotProduct(plane.normal, center) + plane.distance < -radius)
+            return false;
+    }
+    return true;
+}
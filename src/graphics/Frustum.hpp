@@ -0,0 +1,38 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** Frustum
+*/
+
+#ifndef FRUSTUM_HPP_
+#define FRUSTUM_HPP_
+#pragma once
+
+#include <raylib.h>
+
+enum class FrustumTest {
+    OUTSIDE,
+    INTERSECT,
+    INSIDE
+};
+
+struct FrustumPlane {
+    Vector3 normal;
+    float distance;
+};
+
+class Frustum {
+private:
+    FrustumPlane planes[6];
+    void SetPlane(int index, float a, float b, float c, float d);
+
+public:
+    Frustum();
+    void Extract(const Camera3D &camera, float aspect);
+    FrustumTest TestBox(const BoundingBox &box) const;
+    bool IsBoxVisible(const BoundingBox &box) const { return TestBox(box) != FrustumTest::OUTSIDE; }
+    bool IsSphereVisible(Vector3 center, float radius) const;
+};
+
+#endif /* !FRUSTUM_HPP_ */
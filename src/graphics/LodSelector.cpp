@@ -0,0 +1,31 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LodSelector
+*/
+
+#include "LodSelector.hpp"
+#include <cmath>
+#include <algorithm>
+
+float LodSelector::GetProjectedSize(const Camera3D &camera, float distance, float radius, float screenHeight)
+{
+    if (camera.projection == CAMERA_ORTHOGRAPHIC)
+        return 2.0f * radius * screenHeight / std::max(camera.fovy, 0.001f);
+    float halfFov = tanf(camera.fovy * DEG2RAD * 0.5f);
+    return radius * screenHeight / (std::max(distance, 0.01f) * halfFov);
+}
+
+LodLevel LodSelector::Select(float projectedSize, LodLevel current, const LodThresholds &thresholds)
+{
+    // Each boundary is pushed away from the current tier so an object
+    // hovering around a threshold does not flicker between two meshes
+    float mediumBias = current == LodLevel::HIGH ? 1.0f - HYSTERESIS : 1.0f + HYSTERESIS;
+    float lowBias = current == LodLevel::LOW ? 1.0f + HYSTERESIS : 1.0f - HYSTERESIS;
+    if (projectedSize >= thresholds.mediumBelow * mediumBias)
+        return LodLevel::HIGH;
+    if (projectedSize >= thresholds.lowBelow * lowBias)
+        return LodLevel::MEDIUM;
+    return LodLevel::LOW;
+}
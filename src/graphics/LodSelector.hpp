@@ -0,0 +1,38 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LodSelector
+*/
+
+#ifndef LODSELECTOR_HPP_
+#define LODSELECTOR_HPP_
+#pragma once
+
+#include <raylib.h>
+
+enum class LodLevel {
+    HIGH = 0,
+    MEDIUM = 1,
+    LOW = 2
+};
+
+struct LodThresholds {
+    float mediumBelow;
+    float lowBelow;
+};
+
+class LodSelector {
+private:
+    static constexpr float HYSTERESIS = 0.2f;
+
+public:
+    static constexpr int LEVEL_COUNT = 3;
+    static constexpr LodThresholds BOX = {40.0f, 12.0f};
+    static constexpr LodThresholds TARGET = {48.0f, 16.0f};
+    static constexpr LodThresholds PLAYER = {56.0f, 18.0f};
+    static float GetProjectedSize(const Camera3D &camera, float distance, float radius, float screenHeight);
+    static LodLevel Select(float projectedSize, LodLevel current, const LodThresholds &thresholds);
+};
+
+#endif /* !LODSELECTOR_HPP_ */
@@ -0,0 +1,172 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** MeshBuilder
+*/
+
+#include "MeshBuilder.hpp"
+#include <raymath.h>
+#include <cmath>
+#include <cstring>
+
+MeshBuilder::MeshBuilder() {}
+
+MeshBuilder::~MeshBuilder() {}
+
+void MeshBuilder::Clear()
+{
+    vertices.clear();
+    texcoords.clear();
+    normals.clear();
+    colors.clear();
+}
+
+void MeshBuilder::Reserve(int vertexCount)
+{
+    vertices.reserve(vertexCount * 3);
+    texcoords.reserve(vertexCount * 2);
+    normals.reserve(vertexCount * 3);
+    colors.reserve(vertexCount * 4);
+}
+
+void MeshBuilder::AddVertex(Vector3 position, Vector2 uv, Vector3 normal, Color color)
+{
+    vertices.insert(vertices.end(), {position.x, position.y, position.z});
+    texcoords.insert(texcoords.end(), {uv.x, uv.y});
+    normals.insert(normals.end(), {normal.x, normal.y, normal.z});
+    colors.insert(colors.end(), {color.r, color.g, color.b, color.a});
+}
+
+void MeshBuilder::AddFace(Vector3 center, Vector3 normal, Vector3 right, Vector3 up,
+                          float halfWidth, float halfHeight, Rectangle uv, Color color)
+{
+    Vector3 r = Vector3Scale(right, halfWidth);
+    Vector3 u = Vector3Scale(up, halfHeight);
+    Vector3 bottomLeft = Vector3Subtract(Vector3Subtract(center, r), u);
+    Vector3 bottomRight = Vector3Subtract(Vector3Add(center, r), u);
+    Vector3 topRight = Vector3Add(Vector3Add(center, r), u);
+    Vector3 topLeft = Vector3Add(Vector3Subtract(center, r), u);
+    Vector2 uvBottomLeft = {uv.x, uv.y + uv.height};
+    Vector2 uvBottomRight = {uv.x + uv.width, uv.y + uv.height};
+    Vector2 uvTopRight = {uv.x + uv.width, uv.y};
+    Vector2 uvTopLeft = {uv.x, uv.y};
+    AddVertex(bottomLeft, uvBottomLeft, normal, color);
+    AddVertex(bottomRight, uvBottomRight, normal, color);
+    AddVertex(topRight, uvTopRight, normal, color);
+    AddVertex(bottomLeft, uvBottomLeft, normal, color);
+    AddVertex(topRight, uvTopRight, normal, color);
+    AddVertex(topLeft, uvTopLeft, normal, color);
+}
+
+void MeshBuilder::AddTriangle(Vector3 a, Vector3 b, Vector3 c, Color color)
+{
+    Vector3 normal = Vector3Normalize(Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+    AddVertex(a, {0, 0}, normal, color);
+    AddVertex(b, {1, 0}, normal, color);
+    AddVertex(c, {1, 1}, normal, color);
+}
+
+void MeshBuilder::AddCuboid(Vector3 center, Vector3 size, Color color, unsigned int faces, Rectangle uv)
+{
+    Vector3 half = Vector3Scale(size, 0.5f);
+    if (faces & FACE_FRONT)
+        AddFace({center.x, center.y, center.z + half.z}, {0, 0, 1}, {1, 0, 0}, {0, 1, 0},
+                half.x, half.y, uv, color);
+    if (faces & FACE_BACK)
+        AddFace({center.x, center.y, center.z - half.z}, {0, 0, -1}, {-1, 0, 0}, {0, 1, 0},
+                half.x, half.y, uv, color);
+    if (faces & FACE_RIGHT)
+        AddFace({center.x + half.x, center.y, center.z}, {1, 0, 0}, {0, 0, -1}, {0, 1, 0},
+                half.z, half.y, uv, color);
+    if (faces & FACE_LEFT)
+        AddFace({center.x - half.x, center.y, center.z}, {-1, 0, 0}, {0, 0, 1}, {0, 1, 0},
+                half.z, half.y, uv, color);
+    if (faces & FACE_TOP)
+        AddFace({center.x, center.y + half.y, center.z}, {0, 1, 0}, {1, 0, 0}, {0, 0, -1},
+                half.x, half.z, uv, color);
+    if (faces & FACE_BOTTOM)
+        AddFace({center.x, center.y - half.y, center.z}, {0, -1, 0}, {1, 0, 0}, {0, 0, 1},
+                half.x, half.z, uv, color);
+}
+
+void MeshBuilder::AddCylinder(Vector3 base, float radius, float height, int slices, Color color, Rectangle uv)
+{
+    Vector3 top = {base.x, base.y + height, base.z};
+    float vTop = uv.y;
+    float vBottom = uv.y + uv.height;
+    Vector2 uvCenter = {uv.x + uv.width * 0.5f, uv.y + uv.height * 0.5f};
+    for (int i = 0; i < slices; i++) {
+        float a0 = 2.0f * PI * i / slices;
+        float a1 = 2.0f * PI * (i + 1) / slices;
+        float u0 = uv.x + uv.width * i / slices;
+        float u1 = uv.x + uv.width * (i + 1) / slices;
+        Vector3 d0 = {sinf(a0), 0.0f, cosf(a0)};
+        Vector3 d1 = {sinf(a1), 0.0f, cosf(a1)};
+        Vector3 b0 = Vector3Add(base, Vector3Scale(d0, radius));
+        Vector3 b1 = Vector3Add(base, Vector3Scale(d1, radius));
+        Vector3 t0 = Vector3Add(top, Vector3Scale(d0, radius));
+        Vector3 t1 = Vector3Add(top, Vector3Scale(d1, radius));
+        AddVertex(b0, {u0, vBottom}, d0, color);
+        AddVertex(b1, {u1, vBottom}, d1, color);
+        AddVertex(t1, {u1, vTop}, d1, color);
+        AddVertex(b0, {u0, vBottom}, d0, color);
+        AddVertex(t1, {u1, vTop}, d1, color);
+        AddVertex(t0, {u0, vTop}, d0, color);
+        AddVertex(top, uvCenter, {0, 1, 0}, color);
+        AddVertex(t0, {u0, vTop}, {0, 1, 0}, color);
+        AddVertex(t1, {u1, vTop}, {0, 1, 0}, color);
+    }
+}
+
+void MeshBuilder::AddSphere(Vector3 center, float radius, int rings, int slices, Color color, Rectangle uv)
+{
+    for (int r = 0; r < rings; r++) {
+        float theta0 = PI * r / rings;
+        float theta1 = PI * (r + 1) / rings;
+        float v0 = uv.y + uv.height * r / rings;
+        float v1 = uv.y + uv.height * (r + 1) / rings;
+        for (int i = 0; i < slices; i++) {
+            float a0 = 2.0f * PI * i / slices;
+            float a1 = 2.0f * PI * (i + 1) / slices;
+            float u0 = uv.x + uv.width * i / slices;
+            float u1 = uv.x + uv.width * (i + 1) / slices;
+            Vector3 n00 = {sinf(theta0) * sinf(a0), cosf(theta0), sinf(theta0) * cosf(a0)};
+            Vector3 n01 = {sinf(theta0) * sinf(a1), cosf(theta0), sinf(theta0) * cosf(a1)};
+            Vector3 n10 = {sinf(theta1) * sinf(a0), cosf(theta1), sinf(theta1) * cosf(a0)};
+            Vector3 n11 = {sinf(theta1) * sinf(a1), cosf(theta1), sinf(theta1) * cosf(a1)};
+            Vector3 p00 = Vector3Add(center, Vector3Scale(n00, radius));
+            Vector3 p01 = Vector3Add(center, Vector3Scale(n01, radius));
+            Vector3 p10 = Vector3Add(center, Vector3Scale(n10, radius));
+            Vector3 p11 = Vector3Add(center, Vector3Scale(n11, radius));
+            if (r < rings - 1) {
+                AddVertex(p10, {u0, v1}, n10, color);
+                AddVertex(p11, {u1, v1}, n11, color);
+                AddVertex(p01, {u1, v0}, n01, color);
+            }
+            if (r > 0) {
+                AddVertex(p10, {u0, v1}, n10, color);
+                AddVertex(p01, {u1, v0}, n01, color);
+                AddVertex(p00, {u0, v0}, n00, color);
+            }
+        }
+    }
+}
+
+Mesh MeshBuilder::Build() const
+{
+    Mesh mesh = {};
+    if (vertices.empty())
+        return mesh;
+    mesh.vertexCount = GetVertexCount();
+    mesh.triangleCount = mesh.vertexCount / 3;
+    mesh.vertices = static_cast<float *>(MemAlloc(vertices.size() * sizeof(float)));
+    mesh.texcoords = static_cast<float *>(MemAlloc(texcoords.size() * sizeof(float)));
+    mesh.normals = static_cast<float *>(MemAlloc(normals.size() * sizeof(float)));
+    mesh.colors = static_cast<unsigned char *>(MemAlloc(colors.size()));
+    std::memcpy(mesh.vertices, vertices.data(), vertices.size() * sizeof(float));
+    std::memcpy(mesh.texcoords, texcoords.data(), texcoords.size() * sizeof(float));
+    std::memcpy(mesh.normals, normals.data(), normals.size() * sizeof(float));
+    std::memcpy(mesh.colors, colors.data(), colors.size());
+    return mesh;
+}
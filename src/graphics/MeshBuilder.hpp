@@ -0,0 +1,52 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** MeshBuilder
+*/
+
+#ifndef MESHBUILDER_HPP_
+#define MESHBUILDER_HPP_
+#pragma once
+
+#include <raylib.h>
+#include <vector>
+
+enum CuboidFace : unsigned int {
+    FACE_FRONT = 1 << 0,
+    FACE_BACK = 1 << 1,
+    FACE_LEFT = 1 << 2,
+    FACE_RIGHT = 1 << 3,
+    FACE_TOP = 1 << 4,
+    FACE_BOTTOM = 1 << 5,
+    FACE_ALL = 0x3F
+};
+
+class MeshBuilder {
+private:
+    std::vector<float> vertices;
+    std::vector<float> texcoords;
+    std::vector<float> normals;
+    std::vector<unsigned char> colors;
+    void AddVertex(Vector3 position, Vector2 uv, Vector3 normal, Color color);
+    void AddFace(Vector3 center, Vector3 normal, Vector3 right, Vector3 up,
+                 float halfWidth, float halfHeight, Rectangle uv, Color color);
+
+public:
+    MeshBuilder();
+    ~MeshBuilder();
+    void Clear();
+    void Reserve(int vertexCount);
+    bool IsEmpty() const { return vertices.empty(); }
+    int GetVertexCount() const { return static_cast<int>(vertices.size() / 3); }
+    void AddTriangle(Vector3 a, Vector3 b, Vector3 c, Color color);
+    void AddCuboid(Vector3 center, Vector3 size, Color color,
+                   unsigned int faces = FACE_ALL, Rectangle uv = {0, 0, 1, 1});
+    void AddCylinder(Vector3 base, float radius, float height, int slices, Color color,
+                     Rectangle uv = {0, 0, 1, 1});
+    void AddSphere(Vector3 center, float radius, int rings, int slices, Color color,
+                   Rectangle uv = {0, 0, 1, 1});
+    Mesh Build() const;
+};
+
+#endif /* !MESHBUILDER_HPP_ */
@@ -0,0 +1,153 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** RenderQueue
+*/
+
+#include "RenderQueue.hpp"
+#include <raymath.h>
+#include <rlgl.h>
+#include <algorithm>
+
+static constexpr unsigned long long PASS_OPAQUE = 0ULL;
+static constexpr unsigned long long PASS_LINES = 1ULL;
+static constexpr unsigned long long PASS_TRANSLUCENT = 2ULL;
+static constexpr unsigned long long DEPTH_MASK = 0xFFFFFFULL;
+
+RenderQueue::RenderQueue()
+    : batchFlushCount(0)
+    , unsortedBatchFlushCount(0)
+{
+}
+
+void RenderQueue::Clear()
+{
+    commands.clear();
+}
+
+void RenderQueue::SubmitMesh(const Mesh &mesh, const Material &material, Matrix transform,
+                             Vector3 center, Color tint, bool translucent)
+{
+    RenderCommand command = {};
+    command.type = RenderCommandType::MESH;
+    command.mesh = &mesh;
+    command.material = material;
+    command.transform = transform;
+    command.position = center;
+    command.color = tint;
+    command.translucent = translucent || tint.a < 255;
+    commands.push_back(command);
+}
+
+void RenderQueue::SubmitInstanced(const Mesh &mesh, const Material &material,
+                                  const std::vector<Matrix> &transforms, Color tint)
+{
+    if (transforms.empty())
+        return;
+    RenderCommand command = {};
+    command.type = RenderCommandType::INSTANCED;
+    command.mesh = &mesh;
+    command.material = material;
+    command.instances = transforms.data();
+    command.instanceCount = static_cast<int>(transforms.size());
+    command.position = {transforms[0].m12, transforms[0].m13, transforms[0].m14};
+    command.color = tint;
+    commands.push_back(command);
+}
+
+void RenderQueue::SubmitLine(Vector3 start, Vector3 end, Color color)
+{
+    RenderCommand command = {};
+    command.type = RenderCommandType::LINE;
+    command.position = start;
+    command.lineEnd = end;
+    command.color = color;
+    commands.push_back(command);
+}
+
+unsigned long long RenderQueue::MakeSortKey(const RenderCommand &command, float depth)
+{
+    // [pass:2][shader:8][texture:14][mesh:16][depth:24] for opaque geometry,
+    // [pass:2][inverted depth:24] for translucent so far objects come first
+    unsigned long long depthBits = std::min(static_cast<unsigned long long>(std::max(depth, 0.0f) * 256.0f), DEPTH_MASK);
+    if (command.type == RenderCommandType::LINE)
+        return PASS_LINES << 62;
+    if (command.translucent)
+        return (PASS_TRANSLUCENT << 62) | (DEPTH_MASK - depthBits);
+    unsigned long long shader = command.material.shader.id & 0xFFULL;
+    unsigned long long texture = command.material.maps[MATERIAL_MAP_DIFFUSE].texture.id & 0x3FFFULL;
+    unsigned long long mesh = command.mesh->vaoId & 0xFFFFULL;
+    return (PASS_OPAQUE << 62) | (shader << 54) | (texture << 40) | (mesh << 24) | depthBits;
+}
+
+bool RenderQueue::SameState(const RenderCommand &a, const RenderCommand &b)
+{
+    if (a.type == RenderCommandType::LINE || b.type == RenderCommandType::LINE)
+        return a.type == b.type;
+    return a.translucent == b.translucent
+        && a.material.shader.id == b.material.shader.id
+        && a.material.maps[MATERIAL_MAP_DIFFUSE].texture.id == b.material.maps[MATERIAL_MAP_DIFFUSE].texture.id;
+}
+
+int RenderQueue::CountStateChanges(const std::vector<RenderCommand> &list)
+{
+    int changes = 0;
+    for (size_t i = 1; i < list.size(); i++) {
+        if (!SameState(list[i - 1], list[i]))
+            changes++;
+    }
+    return changes;
+}
+
+int RenderQueue::Execute(const RenderCommand &command) const
+{
+    switch (command.type) {
+        case RenderCommandType::LINE:
+            DrawLine3D(command.position, command.lineEnd, command.color);
+            return 0;
+        case RenderCommandType::INSTANCED:
+            command.material.maps[MATERIAL_MAP_DIFFUSE].color = command.color;
+            DrawMeshInstanced(*command.mesh, command.material, command.instances, command.instanceCount);
+            return 1;
+        case RenderCommandType::MESH:
+            command.material.maps[MATERIAL_MAP_DIFFUSE].color = command.color;
+            DrawMesh(*command.mesh, command.material, command.transform);
+            return 1;
+    }
+    return 0;
+}
+
+int RenderQueue::Flush(Vector3 viewPosition)
+{
+    if (commands.empty()) {
+        batchFlushCount = 0;
+        unsortedBatchFlushCount = 0;
+        return 0;
+    }
+    unsortedBatchFlushCount = CountStateChanges(commands);
+    for (RenderCommand &command : commands)
+        command.sortKey = MakeSortKey(command, Vector3Distance(viewPosition, command.position));
+    std::sort(commands.begin(), commands.end(), [](const RenderCommand &a, const RenderCommand &b) {
+        return a.sortKey < b.sortKey;
+    });
+    batchFlushCount = CountStateChanges(commands);
+    int drawCalls = 0;
+    bool depthMaskDisabled = false;
+    for (size_t i = 0; i < commands.size(); i++) {
+        const RenderCommand &command = commands[i];
+        if (i > 0 && commands[i - 1].type == RenderCommandType::LINE && command.type != RenderCommandType::LINE)
+            rlDrawRenderBatchActive();
+        if (command.translucent && !depthMaskDisabled) {
+            rlDrawRenderBatchActive();
+            rlDisableDepthMask();
+            depthMaskDisabled = true;
+        }
+        drawCalls += Execute(command);
+    }
+    rlDrawRenderBatchActive();
+    if (depthMaskDisabled)
+        rlEnableDepthMask();
+    commands.clear();
+    return drawCalls;
+}
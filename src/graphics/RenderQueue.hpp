@@ -0,0 +1,60 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** RenderQueue
+*/
+
+#ifndef RENDERQUEUE_HPP_
+#define RENDERQUEUE_HPP_
+#pragma once
+
+#include <raylib.h>
+#include <vector>
+
+enum class RenderCommandType {
+    MESH,
+    INSTANCED,
+    LINE
+};
+
+struct RenderCommand {
+    RenderCommandType type;
+    const Mesh *mesh;
+    Material material;
+    Matrix transform;
+    const Matrix *instances;
+    int instanceCount;
+    Vector3 position;
+    Vector3 lineEnd;
+    Color color;
+    bool translucent;
+    unsigned long long sortKey;
+};
+
+class RenderQueue {
+private:
+    std::vector<RenderCommand> commands;
+    int batchFlushCount;
+    int unsortedBatchFlushCount;
+    static unsigned long long MakeSortKey(const RenderCommand &command, float depth);
+    static int CountStateChanges(const std::vector<RenderCommand> &list);
+    static bool SameState(const RenderCommand &a, const RenderCommand &b);
+    int Execute(const RenderCommand &command) const;
+
+public:
+    RenderQueue();
+    void Clear();
+    void SubmitMesh(const Mesh &mesh, const Material &material, Matrix transform,
+                    Vector3 center, Color tint, bool translucent = false);
+    void SubmitInstanced(const Mesh &mesh, const Material &material,
+                         const std::vector<Matrix> &transforms, Color tint);
+    void SubmitLine(Vector3 start, Vector3 end, Color color);
+    int Flush(Vector3 viewPosition);
+    bool IsEmpty() const { return commands.empty(); }
+    int GetCommandCount() const { return static_cast<int>(commands.size()); }
+    int GetBatchFlushCount() const { return batchFlushCount; }
+    int GetUnsortedBatchFlushCount() const { return unsortedBatchFlushCount; }
+};
+
+#endif /* !RENDERQUEUE_HPP_ */
@@ -13,6 +13,10 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include "StaticGeometry.hpp"
+#include "Frustum.hpp"
+#include "LodSelector.hpp"
+#include "StaticLayerCache.hpp"
 
 struct RenderObject {
     Model model;
@@ -25,35 +29,51 @@ struct RenderObject {
                      tint(WHITE), visible(true) {}
 };
 
+class Level;
+class MeshBuilder;
+
 class Renderer {
 private:
     Camera3D camera;
     std::vector<std::unique_ptr<RenderObject>> objects;
-    Model playerModel;
-    Model boxModel;
-    Model wallModel;
-    Model floorModel;
-    Model targetModel;
+    Model playerModels[LodSelector::LEVEL_COUNT];
+    Model boxModels[LodSelector::LEVEL_COUNT];
+    Model cylinderModel;
+    Model effectCubeModel;
+    Model particleModel;
     Texture2D playerTexture;
-    Texture2D boxTexture;
-    Texture2D wallTexture;
-    Texture2D floorTexture;
-    Texture2D targetTexture;
+    Texture2D tileAtlas;
     Material playerMaterial;
-    Material boxMaterial;
-    Material wallMaterial;
-    Material floorMaterial;
-    Material targetMaterial;
+    Shader instancingShader;
+    Material instanceMaterial;
+    bool instancingSupported;
+    std::unique_ptr<StaticGeometry> staticGeometry;
+    RenderQueue renderQueue;
+    StaticLayerCache staticLayer;
+    bool staticLayerActive;
+    Frustum frustum;
+    std::vector<Matrix> bollardCapInstances;
+    std::vector<Matrix> boxInstances[LodSelector::LEVEL_COUNT];
+    std::vector<Matrix> boxOnTargetInstances[LodSelector::LEVEL_COUNT];
+    LodLevel playerLod;
+    float lodScreenHeight;
+    int drawCallCount;
     bool modelsLoaded;
     bool texturesLoaded;
     Vector3 lightPosition;
     void LoadModels();
     void LoadTextures();
     void LoadMaterials();
+    void LoadInstancingShader();
     void UnloadModels();
     void UnloadTextures();
-    Model CreateCubeModel();
-    Model CreatePlaneModel();
+    void UnloadInstancingShader();
+    void UpdateFrustum();
+    void SubmitStaticGeometry();
+    void PrepareStaticLayer();
+    void DrawInstanceBatch(const Mesh &mesh, const std::vector<Matrix> &transforms, Color color);
+    void SubmitModel(const Model &model, Vector3 position, Vector3 scale, Color tint, float rotation = 0.0f);
+    Model CreateModelFromBuilder(const MeshBuilder &builder);
     Texture2D CreateColorTexture(Color color);
     bool FileExists(const std::string& path);
 
@@ -64,6 +84,8 @@ public:
     void Shutdown();
     void BeginFrame();
     void EndFrame();
+    void Begin3D();
+    void End3D();
     void Clear(Color color = {20, 20, 40, 255});
     void SetCamera(Vector3 position, Vector3 target, Vector3 up);
     void UpdateCamera();
@@ -71,10 +93,22 @@ public:
     void SetCameraTarget(Vector3 target);
     const Camera3D& GetCamera() const { return camera; }
     void DrawPlayer(Vector3 position, float rotation = 0.0f);
-    void DrawBox(Vector3 position, bool onTarget = false);
-    void DrawWall(Vector3 position);
-    void DrawFloor(Vector3 position);
-    void DrawTarget(Vector3 position);
+    bool ExportPlayerMeshes(const std::string &directory) const;
+    void DrawBoxEffects(Vector3 position, LodLevel lod = LodLevel::HIGH);
+    void BuildLevelGeometry(const Level &level);
+    void AdoptLevelGeometry(std::unique_ptr<StaticGeometry> geometry);
+    int UpdateLevelGeometry(const Level &previous, const Level &next);
+    void ClearLevelGeometry();
+    void ClearBoxInstances();
+    LodLevel AddBoxInstance(Vector3 position, bool onTarget = false, LodLevel current = LodLevel::HIGH);
+    LodLevel SelectLod(Vector3 center, float radius, LodLevel current, const LodThresholds &thresholds) const;
+    void DrawLevel();
+    int GetDrawCallCount() const { return drawCallCount; }
+    bool IsVisible(Vector3 center, float radius) const { return frustum.IsSphereVisible(center, radius); }
+    int GetVisibleChunkCount() const { return staticGeometry->GetVisibleChunkCount(); }
+    bool RefreshStaticLayer();
+    int GetBatchFlushCount() const { return renderQueue.GetBatchFlushCount(); }
+    int GetUnsortedBatchFlushCount() const { return renderQueue.GetUnsortedBatchFlushCount(); }
     void DrawModelEx(Model model, Vector3 position, Vector3 rotationAxis, 
                      float rotationAngle, Vector3 scale, Color tint);
     void DrawBoundingBox(Vector3 position, Vector3 size, Color color);
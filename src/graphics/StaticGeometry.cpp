@@ -0,0 +1,406 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** StaticGeometry
+*/
+
+#include "StaticGeometry.hpp"
+#include "MeshBuilder.hpp"
+#include "TextureBaker.hpp"
+#include "../level/Level.hpp"
+#include <raymath.h>
+#include <iostream>
+#include <algorithm>
+
+StaticGeometry::StaticGeometry()
+    : chunksX(0)
+    , chunksY(0)
+    , levelWidth(0)
+    , levelHeight(0)
+    , material()
+    , materialLoaded(false)
+    , uploaded(false)
+    , texture() {
+}
+
+StaticGeometry::~StaticGeometry()
+{
+    Unload();
+}
+
+void StaticGeometry::Build(const Level &level)
+{
+    Unload();
+    Prepare(level);
+    Upload();
+}
+
+// CPU half of Build(): fills the chunk meshes without touching the GPU, so it
+// may run on a worker thread as long as the object is not uploaded yet
+void StaticGeometry::Prepare(const Level &level)
+{
+    chunks.clear();
+    visibleChunks.clear();
+    uploaded = false;
+    chunksX = (level.GetWidth() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    chunksY = (level.GetHeight() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    levelWidth = level.GetWidth();
+    levelHeight = level.GetHeight();
+    chunkLookup.assign(chunksX * chunksY, -1);
+    MeshBuilder builder;
+    builder.Reserve(CHUNK_SIZE * CHUNK_SIZE * 36);
+    for (int cy = 0; cy < chunksY; cy++) {
+        for (int cx = 0; cx < chunksX; cx++) {
+            StaticChunk chunk;
+            if (!BuildChunkMeshes(level, cx, cy, builder, chunk))
+                continue;
+            chunkLookup[cy * chunksX + cx] = static_cast<int>(chunks.size());
+            chunks.push_back(chunk);
+        }
+    }
+}
+
+bool StaticGeometry::BuildChunkMeshes(const Level &level, int chunkX, int chunkY, MeshBuilder &builder,
+                                      StaticChunk &chunk) const
+{
+    chunk = {};
+    chunk.chunkX = chunkX;
+    chunk.chunkY = chunkY;
+    chunk.lod = LodLevel::HIGH;
+    chunk.bounds = GetRegionBounds(chunkX, chunkY, chunkX + 1, chunkY + 1);
+    BuildChunk(level, chunk, builder, LodLevel::HIGH, &chunk.capInstances);
+    if (builder.IsEmpty())
+        return false;
+    chunk.meshes[0] = builder.Build();
+    chunk.meshCount = 1;
+    // Only chunks holding targets have anything to simplify
+    if (!chunk.capInstances.empty()) {
+        for (int lod = 1; lod < LodSelector::LEVEL_COUNT; lod++) {
+            BuildChunk(level, chunk, builder, static_cast<LodLevel>(lod), nullptr);
+            chunk.meshes[lod] = builder.Build();
+        }
+        chunk.meshCount = LodSelector::LEVEL_COUNT;
+    }
+    return true;
+}
+
+std::vector<int> StaticGeometry::FindDirtyChunks(const Level &previous, const Level &next) const
+{
+    // Only walls and targets end up in the static meshes. A changed wall also
+    // changes which faces its neighbours show, hence the one tile margin
+    std::vector<int> dirty;
+    if (previous.GetWidth() != levelWidth || previous.GetHeight() != levelHeight ||
+        next.GetWidth() != levelWidth || next.GetHeight() != levelHeight)
+        return dirty;
+    std::vector<uint8_t> marked(chunksX * chunksY, 0);
+    const std::vector<uint8_t> &before = previous.GetCells();
+    const std::vector<uint8_t> &after = next.GetCells();
+    for (int y = 0; y < levelHeight; y++) {
+        for (int x = 0; x < levelWidth; x++) {
+            size_t index = static_cast<size_t>(y) * levelWidth + x;
+            if (((before[index] ^ after[index]) & (CELL_WALL | CELL_TARGET)) == 0)
+                continue;
+            int cx0 = std::max(x - 1, 0) / CHUNK_SIZE;
+            int cx1 = std::min(x + 1, levelWidth - 1) / CHUNK_SIZE;
+            int cy0 = std::max(y - 1, 0) / CHUNK_SIZE;
+            int cy1 = std::min(y + 1, levelHeight - 1) / CHUNK_SIZE;
+            for (int cy = cy0; cy <= cy1; cy++) {
+                for (int cx = cx0; cx <= cx1; cx++)
+                    marked[cy * chunksX + cx] = 1;
+            }
+        }
+    }
+    for (size_t i = 0; i < marked.size(); i++) {
+        if (marked[i])
+            dirty.push_back(static_cast<int>(i));
+    }
+    return dirty;
+}
+
+void StaticGeometry::RebuildChunks(const Level &level, const std::vector<int> &dirtyChunks)
+{
+    // Chunks that end up empty keep their slot with no meshes; they are never
+    // referenced from chunkLookup again, so culling skips them
+    MeshBuilder builder;
+    builder.Reserve(CHUNK_SIZE * CHUNK_SIZE * 36);
+    for (int cell : dirtyChunks) {
+        int slot = chunkLookup[cell];
+        if (slot >= 0) {
+            StaticChunk &old = chunks[slot];
+            for (int i = 0; i < old.meshCount; i++)
+                UnloadMesh(old.meshes[i]);
+            old.meshCount = 0;
+            old.capInstances.clear();
+            chunkLookup[cell] = -1;
+        }
+        StaticChunk chunk;
+        if (!BuildChunkMeshes(level, cell % chunksX, cell / chunksX, builder, chunk))
+            continue;
+        for (int i = 0; i < chunk.meshCount; i++)
+            UploadMesh(&chunk.meshes[i], false);
+        if (slot < 0) {
+            slot = static_cast<int>(chunks.size());
+            chunks.push_back(chunk);
+        } else {
+            chunks[slot] = chunk;
+        }
+        chunkLookup[cell] = slot;
+    }
+    visibleChunks.clear();
+}
+
+void StaticGeometry::Upload()
+{
+    if (!materialLoaded) {
+        material = LoadMaterialDefault();
+        if (texture.id > 0)
+            material.maps[MATERIAL_MAP_DIFFUSE].texture = texture;
+        materialLoaded = true;
+    }
+    size_t meshTotal = 0;
+    for (StaticChunk &chunk : chunks) {
+        if (!uploaded) {
+            for (int i = 0; i < chunk.meshCount; i++)
+                UploadMesh(&chunk.meshes[i], false);
+        }
+        meshTotal += chunk.meshCount;
+    }
+    uploaded = true;
+    std::cout << "Static geometry: " << chunks.size() << " chunks ("
+              << chunksX << "x" << chunksY << " grid, " << meshTotal << " meshes)" << std::endl;
+}
+
+void StaticGeometry::BuildChunk(const Level &level, const StaticChunk &chunk, MeshBuilder &builder,
+                                LodLevel lod, std::vector<Matrix> *caps) const
+{
+    builder.Clear();
+    int startX = chunk.chunkX * CHUNK_SIZE;
+    int startY = chunk.chunkY * CHUNK_SIZE;
+    int endX = std::min(startX + CHUNK_SIZE, level.GetWidth());
+    int endY = std::min(startY + CHUNK_SIZE, level.GetHeight());
+    auto isOpen = [&level](int nx, int ny) {
+        return !level.IsValidPosition(nx, ny) || level.GetTileType(nx, ny) != TileType::WALL;
+    };
+    for (int y = startY; y < endY; y++) {
+        for (int x = startX; x < endX; x++) {
+            Vector3 worldPos = level.GridToWorld(x, y);
+            if (level.GetTileType(x, y) == TileType::WALL) {
+                unsigned int faces = FACE_TOP;
+                if (isOpen(x, y + 1))
+                    faces |= FACE_FRONT;
+                if (isOpen(x, y - 1))
+                    faces |= FACE_BACK;
+                if (isOpen(x + 1, y))
+                    faces |= FACE_RIGHT;
+                if (isOpen(x - 1, y))
+                    faces |= FACE_LEFT;
+                AddWallTile(builder, worldPos, faces);
+            } else if (level.IsTarget(x, y)) {
+                AddTargetTile(builder, worldPos, lod);
+                if (caps)
+                    AddCapInstances(*caps, worldPos);
+            } else {
+                AddFloorTile(builder, worldPos, (x + y) % 7 == 0);
+            }
+        }
+    }
+}
+
+void StaticGeometry::AddWallTile(MeshBuilder &builder, Vector3 position, unsigned int faces)
+{
+    Vector3 center = {position.x, 1.0f, position.z};
+    Vector3 size = {1.0f, 2.0f, 1.0f};
+    builder.AddCuboid(center, size, WHITE, faces & ~(FACE_TOP | FACE_BOTTOM),
+                      TextureBaker::GetTileUV(AtlasTile::WALL_SIDE));
+    builder.AddCuboid(center, size, WHITE, faces & (FACE_TOP | FACE_BOTTOM),
+                      TextureBaker::GetTileUV(AtlasTile::WALL_TOP));
+}
+
+void StaticGeometry::AddFloorTile(MeshBuilder &builder, Vector3 position, bool marked)
+{
+    builder.AddCuboid({position.x, 0.0f, position.z}, {1.0f, 0.0f, 1.0f}, WHITE, FACE_TOP,
+                      TextureBaker::GetTileUV(marked ? AtlasTile::FLOOR_MARKED : AtlasTile::FLOOR));
+}
+
+void StaticGeometry::AddTargetTile(MeshBuilder &builder, Vector3 position, LodLevel lod)
+{
+    Rectangle solid = TextureBaker::GetTileUV(AtlasTile::SOLID);
+    Color concreteDark = {120, 120, 115, 255};
+    Color plotOrange = {255, 140, 0, 255};
+    Color plotWhite = {255, 255, 255, 255};
+    AddFloorTile(builder, position, false);
+    builder.AddCuboid({position.x, 0.03f, position.z}, {0.9f, 0.06f, 0.9f}, WHITE, FACE_TOP,
+                      TextureBaker::GetTileUV(AtlasTile::TARGET));
+    if (lod == LodLevel::LOW)
+        return;
+    builder.AddCuboid({position.x, 0.03f, position.z}, {0.9f, 0.06f, 0.9f}, {100, 100, 95, 255},
+                      FACE_ALL & ~(FACE_TOP | FACE_BOTTOM), solid);
+    static const Vector2 plotOffsets[4] = {
+        {-0.35f, -0.35f}, {0.35f, -0.35f}, {-0.35f, 0.35f}, {0.35f, 0.35f}
+    };
+    for (const Vector2 &offset : plotOffsets) {
+        Vector3 plotBase = {position.x + offset.x, 0.0f, position.z + offset.y};
+        if (lod == LodLevel::MEDIUM) {
+            builder.AddCylinder(plotBase, 0.04f, 0.45f, 4, plotOrange, solid);
+            continue;
+        }
+        builder.AddCylinder(plotBase, 0.04f, 0.1f, 8, concreteDark, solid);
+        builder.AddCylinder({plotBase.x, 0.05f, plotBase.z}, 0.035f, 0.4f, 8, plotOrange, solid);
+        for (int j = 0; j < 3; j++)
+            builder.AddCylinder({plotBase.x, 0.15f + j * 0.1f, plotBase.z}, 0.037f, 0.03f, 8, plotWhite, solid);
+    }
+}
+
+void StaticGeometry::AddCapInstances(std::vector<Matrix> &instances, Vector3 position)
+{
+    static const Vector2 plotOffsets[4] = {
+        {-0.35f, -0.35f}, {0.35f, -0.35f}, {-0.35f, 0.35f}, {0.35f, 0.35f}
+    };
+    for (const Vector2 &offset : plotOffsets) {
+        Vector3 capPos = {position.x + offset.x, 0.45f, position.z + offset.y};
+        instances.push_back(MatrixMultiply(MatrixScale(0.04f, 0.06f, 0.04f),
+                                           MatrixTranslate(capPos.x, capPos.y, capPos.z)));
+    }
+}
+
+void StaticGeometry::AddBoxTile(MeshBuilder &builder, Vector3 center, float size, LodLevel lod)
+{
+    Vector3 extent = {size, size, size};
+    if (lod == LodLevel::LOW) {
+        builder.AddCuboid(center, extent, {200, 150, 100, 255}, FACE_ALL & ~FACE_BOTTOM,
+                          TextureBaker::GetTileUV(AtlasTile::SOLID));
+        return;
+    }
+    builder.AddCuboid(center, extent, WHITE, FACE_ALL & ~(FACE_TOP | FACE_BOTTOM),
+                      TextureBaker::GetTileUV(AtlasTile::BOX_SIDE));
+    builder.AddCuboid(center, extent, WHITE, FACE_TOP | FACE_BOTTOM,
+                      TextureBaker::GetTileUV(AtlasTile::BOX_TOP));
+    if (lod != LodLevel::HIGH)
+        return;
+    Rectangle solid = TextureBaker::GetTileUV(AtlasTile::SOLID);
+    Color metalColor = {80, 80, 90, 255};
+    float half = size * 0.5f;
+    float edge = size * 0.04f;
+    for (int i = 0; i < 4; i++) {
+        float sx = (i & 1) ? half : -half;
+        float sz = (i & 2) ? half : -half;
+        builder.AddCuboid({center.x + sx, center.y, center.z + sz}, {edge, size + edge, edge},
+                          metalColor, FACE_ALL, solid);
+    }
+    for (int i = 0; i < 2; i++) {
+        float sy = i ? half : -half;
+        builder.AddCuboid({center.x, center.y + sy, center.z - half}, {size, edge, edge}, metalColor, FACE_ALL, solid);
+        builder.AddCuboid({center.x, center.y + sy, center.z + half}, {size, edge, edge}, metalColor, FACE_ALL, solid);
+        builder.AddCuboid({center.x - half, center.y + sy, center.z}, {edge, edge, size}, metalColor, FACE_ALL, solid);
+        builder.AddCuboid({center.x + half, center.y + sy, center.z}, {edge, edge, size}, metalColor, FACE_ALL, solid);
+    }
+}
+
+void StaticGeometry::Unload()
+{
+    for (StaticChunk &chunk : chunks) {
+        for (int i = 0; i < chunk.meshCount; i++)
+            UnloadMesh(chunk.meshes[i]);
+    }
+    chunks.clear();
+    chunkLookup.clear();
+    visibleChunks.clear();
+    uploaded = false;
+    chunksX = 0;
+    chunksY = 0;
+    levelWidth = 0;
+    levelHeight = 0;
+    if (materialLoaded) {
+        MemFree(material.maps);
+        materialLoaded = false;
+    }
+}
+
+BoundingBox StaticGeometry::GetRegionBounds(int x0, int y0, int x1, int y1) const
+{
+    float maxX = static_cast<float>(std::min(x1 * CHUNK_SIZE, levelWidth));
+    float maxZ = static_cast<float>(std::min(y1 * CHUNK_SIZE, levelHeight));
+    BoundingBox bounds;
+    bounds.min = {x0 * CHUNK_SIZE - 0.5f, 0.0f, y0 * CHUNK_SIZE - 0.5f};
+    bounds.max = {maxX - 0.5f, 2.0f, maxZ - 0.5f};
+    return bounds;
+}
+
+void StaticGeometry::AddRegion(int x0, int y0, int x1, int y1)
+{
+    for (int cy = y0; cy < y1; cy++) {
+        for (int cx = x0; cx < x1; cx++) {
+            int index = chunkLookup[cy * chunksX + cx];
+            if (index >= 0)
+                visibleChunks.push_back(index);
+        }
+    }
+}
+
+void StaticGeometry::CullRegion(const Frustum &frustum, int x0, int y0, int x1, int y1)
+{
+    if (x0 >= x1 || y0 >= y1)
+        return;
+    FrustumTest result = frustum.TestBox(GetRegionBounds(x0, y0, x1, y1));
+    if (result == FrustumTest::OUTSIDE)
+        return;
+    if (result == FrustumTest::INSIDE || (x1 - x0 == 1 && y1 - y0 == 1)) {
+        AddRegion(x0, y0, x1, y1);
+        return;
+    }
+    int midX = (x0 + x1 + 1) / 2;
+    int midY = (y0 + y1 + 1) / 2;
+    CullRegion(frustum, x0, y0, midX, midY);
+    CullRegion(frustum, midX, y0, x1, midY);
+    CullRegion(frustum, x0, midY, midX, y1);
+    CullRegion(frustum, midX, midY, x1, y1);
+}
+
+int StaticGeometry::Cull(const Frustum &frustum)
+{
+    // Quadtree walk over the chunk grid: whole regions are rejected or
+    // accepted at once, so large levels only pay for the visible border
+    visibleChunks.clear();
+    CullRegion(frustum, 0, 0, chunksX, chunksY);
+    return static_cast<int>(visibleChunks.size());
+}
+
+void StaticGeometry::UpdateLod(const Camera3D &camera, float screenHeight)
+{
+    // Detail is picked from the nearest point of the chunk, so the tiles
+    // closest to the camera decide how much of the chunk gets simplified
+    for (int index : visibleChunks) {
+        StaticChunk &chunk = chunks[index];
+        if (chunk.meshCount == 1)
+            continue;
+        Vector3 closest = Vector3Clamp(camera.position, chunk.bounds.min, chunk.bounds.max);
+        float distance = Vector3Distance(camera.position, closest);
+        float size = LodSelector::GetProjectedSize(camera, distance, 0.5f, screenHeight);
+        chunk.lod = LodSelector::Select(size, chunk.lod, LodSelector::TARGET);
+    }
+}
+
+int StaticGeometry::Submit(RenderQueue &queue) const
+{
+    if (!materialLoaded)
+        return 0;
+    Matrix identity = MatrixIdentity();
+    for (int index : visibleChunks) {
+        const StaticChunk &chunk = chunks[index];
+        int lod = std::min(static_cast<int>(chunk.lod), chunk.meshCount - 1);
+        Vector3 center = Vector3Scale(Vector3Add(chunk.bounds.min, chunk.bounds.max), 0.5f);
+        queue.SubmitMesh(chunk.meshes[lod], material, identity, center, WHITE);
+    }
+    return static_cast<int>(visibleChunks.size());
+}
+
+void StaticGeometry::CollectCapInstances(std::vector<Matrix> &instances) const
+{
+    for (int index : visibleChunks) {
+        if (chunks[index].lod != LodLevel::HIGH)
+            continue;
+        const std::vector<Matrix> &caps = chunks[index].capInstances;
+        instances.insert(instances.end(), caps.begin(), caps.end());
+    }
+}
@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** StaticGeometry
+*/
+
+#ifndef STATICGEOMETRY_HPP_
+#define STATICGEOMETRY_HPP_
+#pragma once
+
+#include <raylib.h>
+#include <vector>
+#include "Frustum.hpp"
+#include "LodSelector.hpp"
+#include "RenderQueue.hpp"
+
+class Level;
+class MeshBuilder;
+
+struct StaticChunk {
+    int chunkX;
+    int chunkY;
+    BoundingBox bounds;
+    Mesh meshes[LodSelector::LEVEL_COUNT];
+    int meshCount;
+    LodLevel lod;
+    std::vector<Matrix> capInstances;
+};
+
+class StaticGeometry {
+private:
+    std::vector<StaticChunk> chunks;
+    std::vector<int> chunkLookup;
+    std::vector<int> visibleChunks;
+    int chunksX;
+    int chunksY;
+    int levelWidth;
+    int levelHeight;
+    Material material;
+    bool materialLoaded;
+    bool uploaded;
+    Texture2D texture;
+    void BuildChunk(const Level &level, const StaticChunk &chunk, MeshBuilder &builder,
+                    LodLevel lod, std::vector<Matrix> *caps) const;
+    bool BuildChunkMeshes(const Level &level, int chunkX, int chunkY, MeshBuilder &builder,
+                          StaticChunk &chunk) const;
+    BoundingBox GetRegionBounds(int x0, int y0, int x1, int y1) const;
+    void CullRegion(const Frustum &frustum, int x0, int y0, int x1, int y1);
+    void AddRegion(int x0, int y0, int x1, int y1);
+
+public:
+    static constexpr int CHUNK_SIZE = 16;
+    StaticGeometry();
+    ~StaticGeometry();
+    static void AddWallTile(MeshBuilder &builder, Vector3 position, unsigned int faces);
+    static void AddFloorTile(MeshBuilder &builder, Vector3 position, bool marked);
+    static void AddTargetTile(MeshBuilder &builder, Vector3 position, LodLevel lod = LodLevel::HIGH);
+    static void AddCapInstances(std::vector<Matrix> &instances, Vector3 position);
+    static void AddBoxTile(MeshBuilder &builder, Vector3 center, float size, LodLevel lod = LodLevel::HIGH);
+    void SetTexture(Texture2D atlas) { texture = atlas; }
+    void Build(const Level &level);
+    void Prepare(const Level &level);
+    void Upload();
+    std::vector<int> FindDirtyChunks(const Level &previous, const Level &next) const;
+    void RebuildChunks(const Level &level, const std::vector<int> &dirtyChunks);
+    void Unload();
+    int Cull(const Frustum &frustum);
+    void UpdateLod(const Camera3D &camera, float screenHeight);
+    int Submit(RenderQueue &queue) const;
+    void CollectCapInstances(std::vector<Matrix> &instances) const;
+    bool IsBuilt() const { return uploaded && !chunks.empty(); }
+    int GetChunkCount() const { return static_cast<int>(chunks.size()); }
+    int GetChunksX() const { return chunksX; }
+    int GetChunksY() const { return chunksY; }
+    int GetVisibleChunkCount() const { return static_cast<int>(visibleChunks.size()); }
+};
+
+#endif /* !STATICGEOMETRY_HPP_ */
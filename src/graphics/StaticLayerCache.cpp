@@ -0,0 +1,161 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** StaticLayerCache
+*/
+
+#include "StaticLayerCache.hpp"
+#include <rlgl.h>
+#include <iostream>
+
+static const char *COMPOSITE_FS = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+uniform sampler2D texture0;
+uniform sampler2D depthTexture;
+out vec4 finalColor;
+void main()
+{
+    float depth = texture(depthTexture, fragTexCoord).r;
+    if (depth >= 1.0)
+        discard;
+    finalColor = texture(texture0, fragTexCoord);
+    gl_FragDepth = depth;
+}
+)";
+
+StaticLayerCache::StaticLayerCache()
+    : target()
+    , compositeShader()
+    , depthTextureLoc(-1)
+    , cachedCamera()
+    , shaderLoaded(false)
+    , targetLoaded(false)
+    , valid(false)
+{
+}
+
+StaticLayerCache::~StaticLayerCache()
+{
+    Shutdown();
+}
+
+bool StaticLayerCache::Initialize()
+{
+    compositeShader = LoadShaderFromMemory(nullptr, COMPOSITE_FS);
+    if (compositeShader.id == 0 || compositeShader.id == rlGetShaderIdDefault()) {
+        std::cerr << "Static layer composite shader unavailable, caching disabled" << std::endl;
+        return false;
+    }
+    depthTextureLoc = GetShaderLocation(compositeShader, "depthTexture");
+    shaderLoaded = true;
+    return true;
+}
+
+void StaticLayerCache::Shutdown()
+{
+    UnloadTarget();
+    if (shaderLoaded) {
+        UnloadShader(compositeShader);
+        shaderLoaded = false;
+    }
+}
+
+bool StaticLayerCache::LoadTarget(int width, int height)
+{
+    UnloadTarget();
+    // LoadRenderTexture() only gives a depth renderbuffer, the composite
+    // pass needs to sample depth so it is attached as a texture instead
+    target.id = rlLoadFramebuffer();
+    if (target.id == 0)
+        return false;
+    rlEnableFramebuffer(target.id);
+    target.texture.id = rlLoadTexture(nullptr, width, height, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8, 1);
+    target.texture.width = width;
+    target.texture.height = height;
+    target.texture.format = PIXELFORMAT_UNCOMPRESSED_R8G8B8A8;
+    target.texture.mipmaps = 1;
+    target.depth.id = rlLoadTextureDepth(width, height, false);
+    target.depth.width = width;
+    target.depth.height = height;
+    target.depth.format = 19;     // Same placeholder LoadRenderTexture() uses for depth
+    target.depth.mipmaps = 1;
+    rlFramebufferAttach(target.id, target.texture.id, RL_ATTACHMENT_COLOR_CHANNEL0, RL_ATTACHMENT_TEXTURE2D, 0);
+    rlFramebufferAttach(target.id, target.depth.id, RL_ATTACHMENT_DEPTH, RL_ATTACHMENT_TEXTURE2D, 0);
+    bool complete = rlFramebufferComplete(target.id);
+    rlDisableFramebuffer();
+    targetLoaded = true;
+    if (!complete) {
+        std::cerr << "Static layer framebuffer incomplete, caching disabled" << std::endl;
+        UnloadTarget();
+        return false;
+    }
+    return true;
+}
+
+void StaticLayerCache::UnloadTarget()
+{
+    if (targetLoaded) {
+        UnloadRenderTexture(target);
+        target = {};
+        targetLoaded = false;
+    }
+    valid = false;
+}
+
+bool StaticLayerCache::SameCamera(const Camera3D &a, const Camera3D &b)
+{
+    return a.position.x == b.position.x && a.position.y == b.position.y && a.position.z == b.position.z
+        && a.target.x == b.target.x && a.target.y == b.target.y && a.target.z == b.target.z
+        && a.up.x == b.up.x && a.up.y == b.up.y && a.up.z == b.up.z
+        && a.fovy == b.fovy && a.projection == b.projection;
+}
+
+bool StaticLayerCache::NeedsRefresh(const Camera3D &camera, int width, int height) const
+{
+    if (!valid || !targetLoaded)
+        return true;
+    if (target.texture.width != width || target.texture.height != height)
+        return true;
+    return !SameCamera(camera, cachedCamera);
+}
+
+bool StaticLayerCache::BeginCapture(const Camera3D &camera, int width, int height)
+{
+    if (!shaderLoaded || width <= 0 || height <= 0)
+        return false;
+    bool sizeChanged = !targetLoaded || target.texture.width != width || target.texture.height != height;
+    if (sizeChanged && !LoadTarget(width, height)) {
+        shaderLoaded = false;
+        return false;
+    }
+    valid = false;
+    cachedCamera = camera;
+    BeginTextureMode(target);
+    ClearBackground(BLANK);
+    BeginMode3D(camera);
+    return true;
+}
+
+void StaticLayerCache::EndCapture()
+{
+    EndMode3D();
+    EndTextureMode();
+    valid = true;
+}
+
+void StaticLayerCache::Composite() const
+{
+    if (!IsReady())
+        return;
+    float width = static_cast<float>(target.texture.width);
+    float height = static_cast<float>(target.texture.height);
+    // Depth test must be on for gl_FragDepth to reach the depth buffer
+    rlEnableDepthTest();
+    BeginShaderMode(compositeShader);
+    SetShaderValueTexture(compositeShader, depthTextureLoc, target.depth);
+    DrawTextureRec(target.texture, {0.0f, 0.0f, width, -height}, {0.0f, 0.0f}, WHITE);
+    EndShaderMode();
+    rlDisableDepthTest();
+}
@@ -0,0 +1,41 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** StaticLayerCache
+*/
+
+#ifndef STATICLAYERCACHE_HPP_
+#define STATICLAYERCACHE_HPP_
+#pragma once
+
+#include <raylib.h>
+
+class StaticLayerCache {
+private:
+    RenderTexture2D target;
+    Shader compositeShader;
+    int depthTextureLoc;
+    Camera3D cachedCamera;
+    bool shaderLoaded;
+    bool targetLoaded;
+    bool valid;
+    bool LoadTarget(int width, int height);
+    void UnloadTarget();
+    static bool SameCamera(const Camera3D &a, const Camera3D &b);
+
+public:
+    StaticLayerCache();
+    ~StaticLayerCache();
+    bool Initialize();
+    void Shutdown();
+    bool IsSupported() const { return shaderLoaded; }
+    bool IsReady() const { return targetLoaded && valid; }
+    void Invalidate() { valid = false; }
+    bool NeedsRefresh(const Camera3D &camera, int width, int height) const;
+    bool BeginCapture(const Camera3D &camera, int width, int height);
+    void EndCapture();
+    void Composite() const;
+};
+
+#endif /* !STATICLAYERCACHE_HPP_ */
@@ -0,0 +1,239 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** TextureBaker
+*/
+
+#include "TextureBaker.hpp"
+#include <cmath>
+
+static unsigned int NextRandom(unsigned int &seed)
+{
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 16) & 0x7FFF;
+}
+
+static Color Shade(Color color, int delta)
+{
+    auto clamp = [](int value) {
+        return static_cast<unsigned char>(value < 0 ? 0 : (value > 255 ? 255 : value));
+    };
+    return {clamp(color.r + delta), clamp(color.g + delta), clamp(color.b + delta), color.a};
+}
+
+Image TextureBaker::BakeTileAtlas()
+{
+    Image atlas = GenImageColor(TILE_SIZE * ATLAS_COLUMNS, TILE_SIZE * ATLAS_ROWS, WHITE);
+    BakeWallSide(atlas, GetTileArea(AtlasTile::WALL_SIDE));
+    BakeWallTop(atlas, GetTileArea(AtlasTile::WALL_TOP));
+    BakeFloor(atlas, GetTileArea(AtlasTile::FLOOR), false);
+    BakeFloor(atlas, GetTileArea(AtlasTile::FLOOR_MARKED), true);
+    BakeTarget(atlas, GetTileArea(AtlasTile::TARGET));
+    BakeBoxSide(atlas, GetTileArea(AtlasTile::BOX_SIDE));
+    BakeBoxTop(atlas, GetTileArea(AtlasTile::BOX_TOP));
+    ImageDrawRectangleRec(&atlas, GetTileArea(AtlasTile::SOLID), WHITE);
+    return atlas;
+}
+
+Rectangle TextureBaker::GetTileArea(AtlasTile tile)
+{
+    int index = static_cast<int>(tile);
+    return {
+        static_cast<float>((index % ATLAS_COLUMNS) * TILE_SIZE),
+        static_cast<float>((index / ATLAS_COLUMNS) * TILE_SIZE),
+        static_cast<float>(TILE_SIZE),
+        static_cast<float>(TILE_SIZE)
+    };
+}
+
+Rectangle TextureBaker::GetTileUV(AtlasTile tile)
+{
+    const float inset = 1.0f;
+    const float atlasWidth = static_cast<float>(TILE_SIZE * ATLAS_COLUMNS);
+    const float atlasHeight = static_cast<float>(TILE_SIZE * ATLAS_ROWS);
+    Rectangle area = GetTileArea(tile);
+    return {
+        (area.x + inset) / atlasWidth,
+        (area.y + inset) / atlasHeight,
+        (area.width - 2.0f * inset) / atlasWidth,
+        (area.height - 2.0f * inset) / atlasHeight
+    };
+}
+
+void TextureBaker::FillArea(Image &atlas, Rectangle area, float u, float v, float w, float h, Color color)
+{
+    Rectangle rect = {
+        area.x + u * area.width,
+        area.y + v * area.height,
+        fmaxf(1.0f, w * area.width),
+        fmaxf(1.0f, h * area.height)
+    };
+    ImageDrawRectangleRec(&atlas, rect, color);
+}
+
+void TextureBaker::DotArea(Image &atlas, Rectangle area, float u, float v, float radius, Color color)
+{
+    int px = static_cast<int>(area.x + u * area.width);
+    int py = static_cast<int>(area.y + v * area.height);
+    int r = static_cast<int>(radius * area.width);
+    if (r < 1)
+        ImageDrawPixel(&atlas, px, py, color);
+    else
+        ImageDrawCircle(&atlas, px, py, r, color);
+}
+
+void TextureBaker::BakeWallSide(Image &atlas, Rectangle area)
+{
+    Color brickColor = {180, 100, 80, 255};
+    Color mortarColor = {220, 220, 210, 255};
+    Color borderColor = {100, 60, 50, 255};
+    const int rows = 8;
+    const float brickHeight = 1.0f / rows;
+    const float brickWidth = 0.4f;
+    const float mortar = 0.012f;
+    unsigned int seed = 1337;
+    FillArea(atlas, area, 0.0f, 0.0f, 1.0f, 1.0f, mortarColor);
+    for (int row = 0; row < rows; row++) {
+        float v = row * brickHeight;
+        float start = (row % 2) ? -brickWidth * 0.5f : 0.0f;
+        for (float u = start; u < 1.0f; u += brickWidth) {
+            float left = fmaxf(u, 0.0f) + mortar;
+            float right = fminf(u + brickWidth, 1.0f) - mortar;
+            Color variation = Shade(brickColor, static_cast<int>(NextRandom(seed) % 21) - 10);
+            FillArea(atlas, area, left, v + mortar * 2.0f, right - left, brickHeight - mortar * 4.0f, variation);
+        }
+    }
+    ImageDrawRectangleLines(&atlas, area, 2, borderColor);
+}
+
+void TextureBaker::BakeWallTop(Image &atlas, Rectangle area)
+{
+    Color brickColor = {180, 100, 80, 255};
+    Color borderColor = {100, 60, 50, 255};
+    FillArea(atlas, area, 0.0f, 0.0f, 1.0f, 1.0f, Shade(brickColor, -15));
+    FillArea(atlas, area, 0.1f, 0.1f, 0.8f, 0.8f, brickColor);
+    ImageDrawRectangleLines(&atlas, area, 2, borderColor);
+}
+
+void TextureBaker::BakeFloor(Image &atlas, Rectangle area, bool marked)
+{
+    Color concreteBase = {140, 140, 130, 255};
+    Color jointColor = {80, 80, 75, 255};
+    Color microJointColor = {120, 120, 115, 255};
+    Color stainColor = {100, 100, 95, 255};
+    Color edgeColor = {160, 160, 150, 255};
+    Color textureColor = {130, 130, 125, 255};
+    Color markingColor = {200, 180, 60, 255};
+    unsigned int seed = marked ? 4242 : 2024;
+    FillArea(atlas, area, 0.0f, 0.0f, 1.0f, 1.0f, concreteBase);
+    for (float offset = -0.4f; offset <= 0.41f; offset += 0.2f) {
+        FillArea(atlas, area, 0.05f, 0.5f + offset, 0.9f, 0.0f, microJointColor);
+        FillArea(atlas, area, 0.5f + offset, 0.05f, 0.0f, 0.9f, microJointColor);
+    }
+    for (int i = 0; i < 3; i++) {
+        float u = 0.5f + (static_cast<int>(NextRandom(seed) % 100) - 50) / 100.0f * 0.6f;
+        float v = 0.5f + (static_cast<int>(NextRandom(seed) % 100) - 50) / 100.0f * 0.6f;
+        float size = (NextRandom(seed) % 30 + 10) / 1000.0f;
+        DotArea(atlas, area, u, v, size, stainColor);
+    }
+    for (int i = 0; i < 5; i++) {
+        float u = 0.5f + (i * 37 % 100 - 50) / 100.0f * 0.8f;
+        float v = 0.5f + (i * 73 % 100 - 50) / 100.0f * 0.8f;
+        for (int j = 0; j < 4; j++)
+            DotArea(atlas, area, u + (j % 2 - 0.5f) * 0.02f, v + (j / 2 - 0.5f) * 0.02f, 0.0f, textureColor);
+    }
+    if (marked) {
+        for (int step = 0; step < 10; step += 2) {
+            float t = step / 10.0f;
+            for (float s = 0.0f; s < 0.06f; s += 0.005f)
+                DotArea(atlas, area, 0.2f + (t + s) * 0.6f, 0.2f + (t + s) * 0.6f, 0.008f, markingColor);
+        }
+    }
+    ImageDrawRectangleLines(&atlas, {area.x + 3, area.y + 3, area.width - 6, area.height - 6}, 1, edgeColor);
+    FillArea(atlas, area, 0.0f, 0.0f, 1.0f, 0.015f, jointColor);
+    FillArea(atlas, area, 0.0f, 0.0f, 0.015f, 1.0f, jointColor);
+}
+
+void TextureBaker::BakeTarget(Image &atlas, Rectangle area)
+{
+    Color concreteBase = {160, 160, 155, 255};
+    Color borderColor = {100, 100, 95, 255};
+    Color markingPaint = {255, 220, 0, 255};
+    Color centerColor = {255, 50, 50, 255};
+    Color arrowColor = {255, 100, 100, 255};
+    Color plotOrange = {255, 140, 0, 255};
+    FillArea(atlas, area, 0.0f, 0.0f, 1.0f, 1.0f, borderColor);
+    FillArea(atlas, area, 0.045f, 0.045f, 0.91f, 0.91f, concreteBase);
+    FillArea(atlas, area, 0.5f - 0.333f, 0.5f - 0.028f, 0.667f, 0.056f, markingPaint);
+    FillArea(atlas, area, 0.5f - 0.028f, 0.5f - 0.333f, 0.056f, 0.667f, markingPaint);
+    FillArea(atlas, area, 0.5f - 0.017f, 0.5f - 0.333f - 0.067f, 0.034f, 0.133f, arrowColor);
+    FillArea(atlas, area, 0.5f - 0.017f, 0.5f + 0.333f - 0.067f, 0.034f, 0.133f, arrowColor);
+    FillArea(atlas, area, 0.5f - 0.333f - 0.067f, 0.5f - 0.017f, 0.133f, 0.034f, arrowColor);
+    FillArea(atlas, area, 0.5f + 0.333f - 0.067f, 0.5f - 0.017f, 0.133f, 0.034f, arrowColor);
+    FillArea(atlas, area, 0.5f - 0.083f, 0.5f - 0.222f - 0.056f, 0.167f, 0.111f, plotOrange);
+    FillArea(atlas, area, 0.5f - 0.072f, 0.5f - 0.222f - 0.044f, 0.144f, 0.089f, WHITE);
+    DotArea(atlas, area, 0.5f, 0.5f, 0.089f, centerColor);
+}
+
+void TextureBaker::BakeBoxSide(Image &atlas, Rectangle area)
+{
+    Color woodColor = {200, 150, 100, 255};
+    Color darkWoodColor = {180, 130, 80, 255};
+    Color plankBorderColor = {80, 50, 30, 255};
+    Color metalColor = {80, 80, 90, 255};
+    Color rustColor = {120, 80, 60, 255};
+    Color boltColor = {60, 60, 70, 255};
+    Color knotColor = Shade(darkWoodColor, -20);
+    const float plankWidth = 1.0f / 6.0f;
+    for (int i = 0; i < 6; i++) {
+        FillArea(atlas, area, i * plankWidth, 0.0f, plankWidth, 1.0f, i % 2 == 0 ? woodColor : darkWoodColor);
+        if (i > 0)
+            FillArea(atlas, area, i * plankWidth, 0.0f, 0.008f, 1.0f, plankBorderColor);
+    }
+    unsigned int seed = 777;
+    for (int i = 0; i < 8; i++) {
+        float u = 0.5f + (static_cast<int>(NextRandom(seed) % 100) - 50) / 100.0f * 0.7f;
+        float v = 0.5f + (static_cast<int>(NextRandom(seed) % 100) - 50) / 100.0f * 0.7f;
+        DotArea(atlas, area, u, v, i < 4 ? 0.022f : 0.044f, i < 4 ? knotColor : Fade(knotColor, 0.8f));
+    }
+    FillArea(atlas, area, 0.0f, 0.0f, 1.0f, 0.045f, metalColor);
+    FillArea(atlas, area, 0.0f, 0.955f, 1.0f, 0.045f, metalColor);
+    FillArea(atlas, area, 0.0f, 0.0f, 0.025f, 1.0f, metalColor);
+    FillArea(atlas, area, 0.975f, 0.0f, 0.025f, 1.0f, metalColor);
+    FillArea(atlas, area, 0.0f, 0.67f, 0.03f, 0.11f, rustColor);
+    FillArea(atlas, area, 0.97f, 0.67f, 0.03f, 0.11f, rustColor);
+    for (int bolt = 0; bolt < 3; bolt++) {
+        float u = 0.5f + (bolt - 1) * 0.333f;
+        DotArea(atlas, area, u, 0.022f, 0.017f, boltColor);
+        DotArea(atlas, area, u, 0.978f, 0.017f, boltColor);
+        DotArea(atlas, area, u, 0.022f, 0.011f, metalColor);
+        DotArea(atlas, area, u, 0.978f, 0.011f, metalColor);
+    }
+    FillArea(atlas, area, 0.5f - 0.167f, 0.278f - 0.083f, 0.333f, 0.167f, BEIGE);
+    FillArea(atlas, area, 0.5f - 0.156f, 0.278f - 0.072f, 0.311f, 0.144f, WHITE);
+}
+
+void TextureBaker::BakeBoxTop(Image &atlas, Rectangle area)
+{
+    Color woodColor = {200, 150, 100, 255};
+    Color darkWoodColor = {180, 130, 80, 255};
+    Color plankBorderColor = {80, 50, 30, 255};
+    Color metalColor = {80, 80, 90, 255};
+    Color boltColor = {60, 60, 70, 255};
+    const float plankWidth = 1.0f / 6.0f;
+    for (int i = 0; i < 6; i++) {
+        FillArea(atlas, area, i * plankWidth, 0.0f, plankWidth, 1.0f, i % 2 == 0 ? woodColor : darkWoodColor);
+        if (i > 0)
+            FillArea(atlas, area, i * plankWidth, 0.0f, 0.008f, 1.0f, plankBorderColor);
+    }
+    FillArea(atlas, area, 0.0f, 0.0f, 1.0f, 0.045f, metalColor);
+    FillArea(atlas, area, 0.0f, 0.955f, 1.0f, 0.045f, metalColor);
+    FillArea(atlas, area, 0.0f, 0.0f, 0.045f, 1.0f, metalColor);
+    FillArea(atlas, area, 0.955f, 0.0f, 0.045f, 1.0f, metalColor);
+    for (int bolt = 0; bolt < 3; bolt++) {
+        float u = 0.5f + (bolt - 1) * 0.333f;
+        DotArea(atlas, area, u, 0.022f, 0.017f, boltColor);
+        DotArea(atlas, area, u, 0.978f, 0.017f, boltColor);
+    }
+}
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** TextureBaker
+*/
+
+#ifndef TEXTUREBAKER_HPP_
+#define TEXTUREBAKER_HPP_
+#pragma once
+
+#include <raylib.h>
+
+enum class AtlasTile {
+    WALL_SIDE,
+    WALL_TOP,
+    FLOOR,
+    FLOOR_MARKED,
+    TARGET,
+    BOX_SIDE,
+    BOX_TOP,
+    SOLID
+};
+
+class TextureBaker {
+private:
+    static Rectangle GetTileArea(AtlasTile tile);
+    static void FillArea(Image &atlas, Rectangle area, float u, float v, float w, float h, Color color);
+    static void DotArea(Image &atlas, Rectangle area, float u, float v, float radius, Color color);
+    static void BakeWallSide(Image &atlas, Rectangle area);
+    static void BakeWallTop(Image &atlas, Rectangle area);
+    static void BakeFloor(Image &atlas, Rectangle area, bool marked);
+    static void BakeTarget(Image &atlas, Rectangle area);
+    static void BakeBoxSide(Image &atlas, Rectangle area);
+    static void BakeBoxTop(Image &atlas, Rectangle area);
+
+public:
+    static constexpr int TILE_SIZE = 128;
+    static constexpr int ATLAS_COLUMNS = 4;
+    static constexpr int ATLAS_ROWS = 2;
+    static Image BakeTileAtlas();
+    static Rectangle GetTileUV(AtlasTile tile);
+};
+
+#endif /* !TEXTUREBAKER_HPP_ */
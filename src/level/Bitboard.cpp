@@ -0,0 +1,55 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** Bitboard
+*/
+
+#include "Bitboard.hpp"
+#include <algorithm>
+
+Bitboard::Bitboard()
+    : bitCount(0)
+{
+}
+
+void Bitboard::Resize(size_t bits)
+{
+    bitCount = bits;
+    words.assign((bits + 63) / 64, 0);
+}
+
+void Bitboard::ClearAll()
+{
+    std::fill(words.begin(), words.end(), 0);
+}
+
+size_t Bitboard::Count() const
+{
+    size_t count = 0;
+    for (uint64_t word : words) {
+        count += __builtin_popcountll(word);
+    }
+    return count;
+}
+
+size_t Bitboard::CountAnd(const Bitboard &other) const
+{
+    size_t count = 0;
+    size_t n = std::min(words.size(), other.words.size());
+    for (size_t i = 0; i < n; ++i) {
+        count += __builtin_popcountll(words[i] & other.words[i]);
+    }
+    return count;
+}
+
+bool Bitboard::IsSubsetOf(const Bitboard &other) const
+{
+    if (words.size() > other.words.size())
+        return false;
+    for (size_t i = 0; i < words.size(); ++i) {
+        if (words[i] & ~other.words[i])
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,38 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** Bitboard
+*/
+
+#ifndef BITBOARD_HPP_
+#define BITBOARD_HPP_
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class Bitboard {
+private:
+    std::vector<uint64_t> words;
+    size_t bitCount;
+
+public:
+    Bitboard();
+
+    void Resize(size_t bits);
+    void ClearAll();
+    void Set(size_t bit) { words[bit >> 6] |= 1ULL << (bit & 63); }
+    void Clear(size_t bit) { words[bit >> 6] &= ~(1ULL << (bit & 63)); }
+    bool Test(size_t bit) const { return (words[bit >> 6] >> (bit & 63)) & 1ULL; }
+    size_t Count() const;
+    size_t CountAnd(const Bitboard &other) const;
+    bool IsSubsetOf(const Bitboard &other) const;
+
+    size_t GetBitCount() const { return bitCount; }
+    size_t GetWordCount() const { return words.size(); }
+    const uint64_t *GetWords() const { return words.data(); }
+};
+
+#endif /* !BITBOARD_HPP_ */
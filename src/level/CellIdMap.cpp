@@ -0,0 +1,114 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** CellIdMap
+*/
+
+#include "CellIdMap.hpp"
+#include <utility>
+
+CellIdMap::CellIdMap()
+    : count(0)
+    , shift(64)
+{
+}
+
+void CellIdMap::Reset(size_t expected)
+{
+    // Keep the load factor at or below one half
+    size_t capacity = 8;
+    unsigned int bits = 3;
+    while (capacity < expected * 2) {
+        capacity <<= 1;
+        bits++;
+    }
+    slots.assign(capacity, Slot{EMPTY, -1});
+    shift = 64 - bits;
+    count = 0;
+}
+
+void CellIdMap::Clear()
+{
+    for (Slot &slot : slots)
+        slot.cell = EMPTY;
+    count = 0;
+}
+
+size_t CellIdMap::FindSlot(uint32_t cell) const
+{
+    if (slots.empty())
+        return SIZE_MAX;
+    size_t mask = slots.size() - 1;
+    for (size_t i = Home(cell);; i = (i + 1) & mask) {
+        if (slots[i].cell == cell)
+            return i;
+        if (slots[i].cell == EMPTY)
+            return SIZE_MAX;
+    }
+}
+
+int32_t CellIdMap::Find(uint32_t cell) const
+{
+    size_t slot = FindSlot(cell);
+    return slot == SIZE_MAX ? -1 : slots[slot].id;
+}
+
+void CellIdMap::Insert(uint32_t cell, int32_t id)
+{
+    if ((count + 1) * 2 > slots.size())
+        Grow();
+    size_t mask = slots.size() - 1;
+    size_t i = Home(cell);
+    while (slots[i].cell != EMPTY && slots[i].cell != cell)
+        i = (i + 1) & mask;
+    if (slots[i].cell == EMPTY)
+        count++;
+    slots[i] = {cell, id};
+}
+
+void CellIdMap::EraseSlot(size_t slot)
+{
+    // Backward-shift deletion: pull later entries of the probe run into the
+    // hole so lookups never need tombstones
+    size_t mask = slots.size() - 1;
+    size_t hole = slot;
+    for (size_t i = (hole + 1) & mask; slots[i].cell != EMPTY; i = (i + 1) & mask) {
+        size_t home = Home(slots[i].cell);
+        bool reachable = (hole <= i) ? (hole < home && home <= i) : (hole < home || home <= i);
+        if (reachable)
+            continue;
+        slots[hole] = slots[i];
+        hole = i;
+    }
+    slots[hole].cell = EMPTY;
+    count--;
+}
+
+int32_t CellIdMap::Erase(uint32_t cell)
+{
+    size_t slot = FindSlot(cell);
+    if (slot == SIZE_MAX)
+        return -1;
+    int32_t id = slots[slot].id;
+    EraseSlot(slot);
+    return id;
+}
+
+int32_t CellIdMap::Move(uint32_t from, uint32_t to)
+{
+    int32_t id = Erase(from);
+    if (id >= 0)
+        Insert(to, id);
+    return id;
+}
+
+void CellIdMap::Grow()
+{
+    std::vector<Slot> previous = std::move(slots);
+    Reset(previous.empty() ? 4 : previous.size());
+    for (const Slot &slot : previous) {
+        if (slot.cell != EMPTY)
+            Insert(slot.cell, slot.id);
+    }
+}
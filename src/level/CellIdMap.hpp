@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** CellIdMap
+*/
+
+#ifndef CELLIDMAP_HPP_
+#define CELLIDMAP_HPP_
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// Cell index -> id for the few occupied cells of a level. A flat linear
+// probing table sized to the entry count, so lookups and moves never touch
+// the heap and memory does not grow with the level area
+class CellIdMap {
+private:
+    struct Slot {
+        uint32_t cell;
+        int32_t id;
+    };
+
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+
+    std::vector<Slot> slots;
+    size_t count;
+    unsigned int shift;
+
+    size_t Home(uint32_t cell) const { return static_cast<size_t>((cell * 0x9E3779B97F4A7C15ULL) >> shift); }
+    size_t FindSlot(uint32_t cell) const;
+    void EraseSlot(size_t slot);
+    void Grow();
+
+public:
+    CellIdMap();
+
+    void Reset(size_t expected);
+    void Clear();
+    int32_t Find(uint32_t cell) const;
+    void Insert(uint32_t cell, int32_t id);
+    int32_t Erase(uint32_t cell);
+    int32_t Move(uint32_t from, uint32_t to);
+    size_t GetCount() const { return count; }
+};
+
+#endif /* !CELLIDMAP_HPP_ */
@@ -0,0 +1,41 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** GridPos
+*/
+
+#ifndef GRIDPOS_HPP_
+#define GRIDPOS_HPP_
+#pragma once
+
+#include <cstdint>
+
+struct GridPos {
+    int x;
+    int y;
+};
+
+constexpr GridPos operator+(GridPos a, GridPos b) { return {a.x + b.x, a.y + b.y}; }
+constexpr GridPos operator-(GridPos a, GridPos b) { return {a.x - b.x, a.y - b.y}; }
+constexpr bool operator==(GridPos a, GridPos b) { return a.x == b.x && a.y == b.y; }
+constexpr bool operator!=(GridPos a, GridPos b) { return !(a == b); }
+
+enum class Direction : uint8_t {
+    UP,
+    DOWN,
+    LEFT,
+    RIGHT,
+    NONE
+};
+
+constexpr int DIRECTION_COUNT = 4;
+constexpr GridPos DIRECTION_OFFSETS[DIRECTION_COUNT + 1] = {
+    {0, -1}, {0, 1}, {-1, 0}, {1, 0}, {0, 0}
+};
+constexpr float DIRECTION_ROTATIONS[DIRECTION_COUNT] = {0.0f, 180.0f, -90.0f, 90.0f};
+
+constexpr GridPos DirectionOffset(Direction dir) { return DIRECTION_OFFSETS[static_cast<int>(dir)]; }
+constexpr GridPos Step(GridPos pos, Direction dir) { return pos + DirectionOffset(dir); }
+
+#endif /* !GRIDPOS_HPP_ */
@@ -7,98 +7,12 @@
 
 #include "Level.hpp"
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <algorithm>
-#include <cctype>
-
-class SimpleJSONParser {
-public:
-    static std::string extractString(const std::string &json, const std::string &key)
-    {
-        std::string searchKey = "\"" + key + "\"";
-        size_t keyPos = json.find(searchKey);
-        if (keyPos == std::string::npos)
-            return "";
-        size_t colonPos = json.find(":", keyPos);
-        if (colonPos == std::string::npos)
-            return "";
-        size_t startQuote = json.find("\"", colonPos);
-        if (startQuote == std::string::npos)
-            return "";
-        size_t endQuote = json.find("\"", startQuote + 1);
-        if (endQuote == std::string::npos)
-            return "";
-        return json.substr(startQuote + 1, endQuote - startQuote - 1);
-    }
-
-    static int extractInt(const std::string &json, const std::string &key)
-    {
-        std::string searchKey = "\"" + key + "\"";
-        size_t keyPos = json.find(searchKey);
-        if (keyPos == std::string::npos)
-            return 0;
-        size_t colonPos = json.find(":", keyPos);
-        if (colonPos == std::string::npos)
-            return 0;
-        size_t numStart = colonPos + 1;
-        while (numStart < json.length() && std::isspace(json[numStart])) numStart++;
-        size_t numEnd = numStart;
-        while (numEnd < json.length() && (std::isdigit(json[numEnd]) || json[numEnd] == '-')) numEnd++;
-        if (numEnd <= numStart)
-            return 0;
-        std::string numStr = json.substr(numStart, numEnd - numStart);
-        return std::stoi(numStr);
-    }
-
-    static Vector2 extractVector2(const std::string &json, const std::string &key)
-    {
-        std::string searchKey = "\"" + key + "\"";
-        size_t keyPos = json.find(searchKey);
-        if (keyPos == std::string::npos)
-            return {0, 0};
-        size_t colonPos = json.find(":", keyPos);
-        size_t braceStart = json.find("{", colonPos);
-        size_t braceEnd = json.find("}", braceStart);
-        if (braceStart == std::string::npos || braceEnd == std::string::npos)
-            return {0, 0};
-        std::string objStr = json.substr(braceStart, braceEnd - braceStart + 1);
-        int x = extractInt(objStr, "x");
-        int y = extractInt(objStr, "y");
-        return {(float)x, (float)y};
-    }
-
-    static std::vector<std::string> extractStringArray(const std::string &json, const std::string &key)
-    {
-        std::vector<std::string> result;
-        std::string searchKey = "\"" + key + "\"";
-        size_t keyPos = json.find(searchKey);
-        if (keyPos == std::string::npos)
-            return result;
-        size_t colonPos = json.find(":", keyPos);
-        size_t arrayStart = json.find("[", colonPos);
-        size_t arrayEnd = json.find("]", arrayStart);
-        if (arrayStart == std::string::npos || arrayEnd == std::string::npos)
-            return result;
-        std::string arrayContent = json.substr(arrayStart + 1, arrayEnd - arrayStart - 1);
-        size_t pos = 0;
-        while (pos < arrayContent.length()) {
-            size_t quoteStart = arrayContent.find("\"", pos);
-            if (quoteStart == std::string::npos)
-                break;
-            size_t quoteEnd = arrayContent.find("\"", quoteStart + 1);
-            if (quoteEnd == std::string::npos)
-                break;
-            std::string str = arrayContent.substr(quoteStart + 1, quoteEnd - quoteStart - 1);
-            result.push_back(str);
-            pos = quoteEnd + 1;
-        }
-        return result;
-    }
-};
+#include <cmath>
 
 Level::Level()
-    : isCompleted(false) {
+    : isCompleted(false)
+    , boxHash(0) {
     data.width = 0;
     data.height = 0;
     data.totalBoxes = 0;
@@ -111,148 +25,197 @@ Level::~Level() {}
 bool Level::LoadFromFile(const std::string &filename)
 {
     std::cout << "Loading level from file: " << filename << std::endl;
-    std::ifstream file(filename);
-    if (!file.is_open()) {
+    std::string jsonContent;
+    if (!LevelParser::ReadFile(filename, jsonContent)) {
+        loadError = "could not open file";
         std::cerr << "Error: Could not open level file: " << filename << std::endl;
         return false;
     }
-    std::stringstream buffer;
-    buffer << file.rdbuf();
-    std::string jsonContent = buffer.str();
-    file.close();
     return LoadFromJSON(jsonContent);
 }
 
-bool Level::LoadFromJSON(const std::string &jsonContent)
+bool Level::LoadFromJSON(std::string_view jsonContent)
 {
-    try {
-        data.name = SimpleJSONParser::extractString(jsonContent, "name");
-        data.width = SimpleJSONParser::extractInt(jsonContent, "width");
-        data.height = SimpleJSONParser::extractInt(jsonContent, "height");
-        data.playerStart = SimpleJSONParser::extractVector2(jsonContent, "playerStart");
-        std::vector<std::string> gridStrings = SimpleJSONParser::extractStringArray(jsonContent, "grid");
-        if (data.width <= 0 || data.height <= 0) {
-            std::cerr << "Error: Invalid level dimensions" << std::endl;
-            return false;
-        }
-        if (gridStrings.size() != static_cast<size_t>(data.height)) {
-            std::cerr << "Error: Grid height mismatch" << std::endl;
-            return false;
-        }
-        InitializeGrid();
-        ParseGridFromStrings(gridStrings);
-        CountBoxesAndTargets();
-        std::cout << "Level loaded successfully: " << data.name << std::endl;
-        std::cout << "Dimensions: " << data.width << "x" << data.height << std::endl;
-        std::cout << "Total boxes: " << data.totalBoxes << std::endl;
-        return true;
-    } catch (const std::exception& e) {
-        std::cerr << "Error parsing JSON: " << e.what() << std::endl;
+    LevelSource source;
+    LevelParser parser(jsonContent);
+    if (!parser.Parse(source)) {
+        ParseError error = parser.GetError();
+        loadError = "line " + std::to_string(error.line) + ", column " + std::to_string(error.column)
+                    + ": " + error.message;
+        std::cerr << "Error parsing JSON at " << loadError << std::endl;
         return false;
     }
+    return LoadFromSource(source);
 }
 
-void Level::InitializeGrid()
+bool Level::LoadFromSource(const LevelSource &source)
 {
-    data.grid.clear();
-    data.grid.resize(data.height);
-    for (int y = 0; y < data.height; ++y) {
-        data.grid[y].resize(data.width);
-        for (int x = 0; x < data.width; ++x) {
-            data.grid[y][x].type = TileType::FLOOR;
-            data.grid[y][x].position = GridToWorld(x, y);
-            data.grid[y][x].hasBox = false;
-            data.grid[y][x].isTarget = false;
-        }
+    loadError.clear();
+    if (source.width <= 0 || source.height <= 0) {
+        loadError = "invalid level dimensions";
+        std::cerr << "Error: Invalid level dimensions" << std::endl;
+        return false;
     }
+    if (source.rows.size() != static_cast<size_t>(source.height)) {
+        loadError = "grid has " + std::to_string(source.rows.size()) + " rows, expected "
+                    + std::to_string(source.height);
+        std::cerr << "Error: Grid height mismatch" << std::endl;
+        return false;
+    }
+    data.name = source.name;
+    data.width = source.width;
+    data.height = source.height;
+    data.playerStart = source.playerStart;
+    InitializeGrid();
+    ParseGridFromStrings(source.rows);
+    BuildBitboards();
+    ResetBoxes();
+    CountBoxesAndTargets();
+    return true;
 }
 
-void Level::ParseGridFromStrings(const std::vector<std::string> &gridStrings)
+void Level::InitializeGrid()
+{
+    data.cells.assign(static_cast<size_t>(data.width) * data.height, 0);
+}
+
+void Level::ParseGridFromStrings(const std::vector<std::string_view> &gridStrings)
 {
     boxPositions.clear();
     targetPositions.clear();
     for (int y = 0; y < data.height && y < static_cast<int>(gridStrings.size()); ++y) {
-        const std::string& row = gridStrings[y];
+        std::string_view row = gridStrings[y];
+        uint8_t *cells = data.cells.data() + Index(0, y);
         for (int x = 0; x < data.width && x < static_cast<int>(row.length()); ++x) {
             char c = row[x];
             switch (c) {
                 case '#': // Wall
-                    data.grid[y][x].type = TileType::WALL;
-                    break;
-                case ' ': // Floor
-                    data.grid[y][x].type = TileType::FLOOR;
+                    cells[x] = CELL_WALL;
                     break;
                 case '@': // Player start
-                    data.grid[y][x].type = TileType::PLAYER_START;
-                    data.playerStart = {(float)x, (float)y};
+                    cells[x] = CELL_START;
+                    data.playerStart = {x, y};
                     break;
                 case '$': // Box
-                    data.grid[y][x].type = TileType::FLOOR;
-                    data.grid[y][x].hasBox = true;
-                    boxPositions.push_back({(float)x, (float)y});
+                    cells[x] = CELL_BOX;
+                    boxPositions.push_back({x, y});
                     break;
                 case '.': // Target
-                    data.grid[y][x].type = TileType::TARGET;
-                    data.grid[y][x].isTarget = true;
-                    targetPositions.push_back({(float)x, (float)y});
+                    cells[x] = CELL_TARGET;
+                    targetPositions.push_back({x, y});
                     break;
                 case '*': // Box on target
-                    data.grid[y][x].type = TileType::TARGET;
-                    data.grid[y][x].hasBox = true;
-                    data.grid[y][x].isTarget = true;
-                    boxPositions.push_back({(float)x, (float)y});
-                    targetPositions.push_back({(float)x, (float)y});
+                    cells[x] = CELL_TARGET | CELL_BOX;
+                    boxPositions.push_back({x, y});
+                    targetPositions.push_back({x, y});
                     break;
                 case '+': // Player on target
-                    data.grid[y][x].type = TileType::TARGET;
-                    data.grid[y][x].isTarget = true;
-                    data.playerStart = {(float)x, (float)y};
-                    targetPositions.push_back({(float)x, (float)y});
+                    cells[x] = CELL_TARGET | CELL_START;
+                    data.playerStart = {x, y};
+                    targetPositions.push_back({x, y});
                     break;
-                default:
-                    data.grid[y][x].type = TileType::FLOOR;
+                default: // Floor
+                    cells[x] = 0;
                     break;
             }
         }
     }
 }
 
+void Level::BuildBitboards()
+{
+    const size_t count = data.cells.size();
+    wallBits.Resize(count);
+    targetBits.Resize(count);
+    boxBits.Resize(count);
+    regionVisited.Resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t cell = data.cells[i];
+        if (cell & CELL_WALL)
+            wallBits.Set(i);
+        if (cell & CELL_TARGET)
+            targetBits.Set(i);
+        if (cell & CELL_BOX)
+            boxBits.Set(i);
+    }
+}
+
 void Level::CountBoxesAndTargets()
 {
     data.totalBoxes = static_cast<int>(boxPositions.size());
+    data.boxesOnTargets = static_cast<int>(boxBits.CountAnd(targetBits));
+    isCompleted = (data.boxesOnTargets == data.totalBoxes && data.totalBoxes > 0);
+}
+
+void Level::ResetBoxes()
+{
+    for (uint8_t &cell : data.cells) {
+        cell &= static_cast<uint8_t>(~CELL_BOX);
+    }
+    boxBits.ClearAll();
+    cellBoxIds.Reset(boxPositions.size());
+    boxCells.clear();
+    boxHash = 0;
+    for (const GridPos &boxPos : boxPositions) {
+        if (!IsValidPosition(boxPos))
+            continue;
+        size_t index = Index(boxPos);
+        data.cells[index] |= CELL_BOX;
+        boxBits.Set(index);
+        cellBoxIds.Insert(static_cast<uint32_t>(index), static_cast<int32_t>(boxCells.size()));
+        boxCells.push_back(boxPos);
+        boxHash ^= Zobrist::BoxKey(index);
+    }
+}
+
+void Level::Reset()
+{
+    // Only box cells ever change after load, so undoing the current layout
+    // and replaying the initial one costs O(boxes) instead of O(width*height)
+    for (const GridPos &boxPos : boxCells) {
+        if (!IsValidPosition(boxPos))
+            continue;
+        size_t index = Index(boxPos);
+        data.cells[index] &= static_cast<uint8_t>(~CELL_BOX);
+        boxBits.Clear(index);
+    }
+    cellBoxIds.Clear();
+    boxCells.clear();
+    boxHash = 0;
     data.boxesOnTargets = 0;
-    for (const auto &boxPos : boxPositions) {
-        if (IsTarget((int)boxPos.x, (int)boxPos.y)) {
+    for (const GridPos &boxPos : boxPositions) {
+        if (!IsValidPosition(boxPos))
+            continue;
+        size_t index = Index(boxPos);
+        data.cells[index] |= CELL_BOX;
+        boxBits.Set(index);
+        cellBoxIds.Insert(static_cast<uint32_t>(index), static_cast<int32_t>(boxCells.size()));
+        boxCells.push_back(boxPos);
+        boxHash ^= Zobrist::BoxKey(index);
+        if (targetBits.Test(index))
             data.boxesOnTargets++;
-        }
     }
     isCompleted = (data.boxesOnTargets == data.totalBoxes && data.totalBoxes > 0);
 }
 
-void Level::Reset()
+uint8_t Level::GetCell(int x, int y) const
 {
-    std::cout << "Resetting level..." << std::endl;
-    for (int y = 0; y < data.height; ++y) {
-        for (int x = 0; x < data.width; ++x) {
-            data.grid[y][x].hasBox = false;
-        }
-    }
-    for (const auto &boxPos : boxPositions) {
-        int x = (int)boxPos.x;
-        int y = (int)boxPos.y;
-        if (IsValidPosition(x, y)) {
-            data.grid[y][x].hasBox = true;
-        }
+    if (!IsValidPosition(x, y)) {
+        return CELL_WALL;
     }
-    CountBoxesAndTargets();
+    return data.cells[Index(x, y)];
 }
 
 TileType Level::GetTileType(int x, int y) const
 {
-    if (!IsValidPosition(x, y)) {
+    uint8_t cell = GetCell(x, y);
+    if (cell & CELL_WALL)
         return TileType::WALL;
-    }
-    return data.grid[y][x].type;
+    if (cell & CELL_TARGET)
+        return TileType::TARGET;
+    if (cell & CELL_START)
+        return TileType::PLAYER_START;
+    return TileType::FLOOR;
 }
 
 bool Level::CanMoveToTile(int x, int y) const
@@ -260,27 +223,18 @@ bool Level::CanMoveToTile(int x, int y) const
     if (!IsValidPosition(x, y)) {
         return false;
     }
-    TileType type = data.grid[y][x].type;
-    return (type == TileType::FLOOR ||
-            type == TileType::TARGET ||
-            type == TileType::PLAYER_START) &&
-           !data.grid[y][x].hasBox;
+    size_t index = Index(x, y);
+    return !wallBits.Test(index) && !boxBits.Test(index);
 }
 
 bool Level::HasBox(int x, int y) const
 {
-    if (!IsValidPosition(x, y)) {
-        return false;
-    }
-    return data.grid[y][x].hasBox;
+    return IsValidPosition(x, y) && boxBits.Test(Index(x, y));
 }
 
 bool Level::IsTarget(int x, int y) const
 {
-    if (!IsValidPosition(x, y)) {
-        return false;
-    }
-    return data.grid[y][x].isTarget;
+    return IsValidPosition(x, y) && targetBits.Test(Index(x, y));
 }
 
 bool Level::IsValidPosition(int x, int y) const
@@ -288,51 +242,58 @@ bool Level::IsValidPosition(int x, int y) const
     return x >= 0 && x < data.width && y >= 0 && y < data.height;
 }
 
-void Level::MoveBox(int fromX, int fromY, int toX, int toY)
+int Level::MoveBox(int fromX, int fromY, int toX, int toY)
 {
     if (!IsValidPosition(fromX, fromY) || !IsValidPosition(toX, toY)) {
         std::cerr << "Error: Invalid position for box move" << std::endl;
-        return;
+        return -1;
     }
     if (!HasBox(fromX, fromY)) {
         std::cerr << "Error: No box at source position" << std::endl;
-        return;
+        return -1;
     }
-    if (HasBox(toX, toY) || GetTileType(toX, toY) == TileType::WALL) {
+    if (!CanMoveToTile(toX, toY)) {
         std::cerr << "Error: Cannot move box to occupied/wall position" << std::endl;
-        return;
+        return -1;
     }
-    data.grid[fromY][fromX].hasBox = false;
-    data.grid[toY][toX].hasBox = true;
-    std::cout << "Box moved from (" << fromX << "," << fromY << ") to (" << toX << "," << toY << ")" << std::endl;
+    int boxId = cellBoxIds.Move(static_cast<uint32_t>(Index(fromX, fromY)), static_cast<uint32_t>(Index(toX, toY)));
+    if (boxId >= 0)
+        boxCells[boxId] = {toX, toY};
+    boxHash ^= Zobrist::BoxKey(Index(fromX, fromY)) ^ Zobrist::BoxKey(Index(toX, toY));
+    data.cells[Index(fromX, fromY)] &= static_cast<uint8_t>(~CELL_BOX);
+    data.cells[Index(toX, toY)] |= CELL_BOX;
+    boxBits.Clear(Index(fromX, fromY));
+    boxBits.Set(Index(toX, toY));
+    data.boxesOnTargets += static_cast<int>(targetBits.Test(Index(toX, toY))) -
+                           static_cast<int>(targetBits.Test(Index(fromX, fromY)));
     CheckCompletion();
+    return boxId;
+}
+
+int Level::GetBoxId(GridPos pos) const
+{
+    if (!IsValidPosition(pos))
+        return -1;
+    return cellBoxIds.Find(static_cast<uint32_t>(Index(pos)));
 }
 
+// boxesOnTargets is kept up to date by every box change; only load and reset
+// count it from the bitboards
 void Level::CheckCompletion()
 {
-    int oldBoxesOnTargets = data.boxesOnTargets;
-    data.boxesOnTargets = 0;
-    for (int y = 0; y < data.height; ++y) {
-        for (int x = 0; x < data.width; ++x) {
-            if (data.grid[y][x].hasBox && data.grid[y][x].isTarget) {
-                data.boxesOnTargets++;
-            }
-        }
-    }
-    bool wasCompleted = isCompleted;
     isCompleted = (data.boxesOnTargets == data.totalBoxes && data.totalBoxes > 0);
-    if (data.boxesOnTargets != oldBoxesOnTargets) {
-        std::cout << "Boxes on targets: " << data.boxesOnTargets << "/" << data.totalBoxes << std::endl;
-    }
-    if (isCompleted && !wasCompleted) {
-        std::cout << "🎉 Level completed! 🎉" << std::endl;
-    }
 }
 
 void Level::PlaceBox(int x, int y)
 {
     if (IsValidPosition(x, y) && !HasBox(x, y)) {
-        data.grid[y][x].hasBox = true;
+        data.cells[Index(x, y)] |= CELL_BOX;
+        boxBits.Set(Index(x, y));
+        cellBoxIds.Insert(static_cast<uint32_t>(Index(x, y)), static_cast<int32_t>(boxCells.size()));
+        boxCells.push_back({x, y});
+        boxHash ^= Zobrist::BoxKey(Index(x, y));
+        if (targetBits.Test(Index(x, y)))
+            data.boxesOnTargets++;
         CheckCompletion();
     }
 }
@@ -340,11 +301,59 @@ void Level::PlaceBox(int x, int y)
 void Level::RemoveBox(int x, int y)
 {
     if (IsValidPosition(x, y) && HasBox(x, y)) {
-        data.grid[y][x].hasBox = false;
+        data.cells[Index(x, y)] &= static_cast<uint8_t>(~CELL_BOX);
+        boxBits.Clear(Index(x, y));
+        int boxId = cellBoxIds.Erase(static_cast<uint32_t>(Index(x, y)));
+        if (boxId >= 0)
+            boxCells[boxId] = {-1, -1};
+        boxHash ^= Zobrist::BoxKey(Index(x, y));
+        if (targetBits.Test(Index(x, y)))
+            data.boxesOnTargets--;
         CheckCompletion();
     }
 }
 
+uint64_t Level::GetStateHash(GridPos player) const
+{
+    if (!IsValidPosition(player))
+        return boxHash;
+    return boxHash ^ Zobrist::PlayerKey(Index(player));
+}
+
+uint64_t Level::GetNormalizedStateHash(GridPos player) const
+{
+    return GetStateHash(NormalizePlayerPosition(player));
+}
+
+GridPos Level::NormalizePlayerPosition(GridPos player) const
+{
+    // Positions the player can walk between without pushing are equivalent,
+    // so the smallest reachable cell stands for the whole region
+    if (!IsValidPosition(player))
+        return player;
+    const int width = data.width;
+    size_t best = Index(player);
+    regionCells.clear();
+    regionCells.push_back(best);
+    regionVisited.Set(best);
+    for (size_t head = 0; head < regionCells.size(); ++head) {
+        size_t cell = regionCells[head];
+        best = std::min(best, cell);
+        GridPos pos = {static_cast<int>(cell % width), static_cast<int>(cell / width)};
+        for (int dir = 0; dir < DIRECTION_COUNT; ++dir) {
+            GridPos next = pos + DIRECTION_OFFSETS[dir];
+            if (!CanMoveToTile(next) || regionVisited.Test(Index(next)))
+                continue;
+            regionVisited.Set(Index(next));
+            regionCells.push_back(Index(next));
+        }
+    }
+    // Clearing only the visited cells keeps the cost proportional to the region
+    for (size_t cell : regionCells)
+        regionVisited.Clear(cell);
+    return {static_cast<int>(best % width), static_cast<int>(best / width)};
+}
+
 Vector3 Level::GridToWorld(int x, int y) const
 {
     float worldX = (float)x;
@@ -353,11 +362,9 @@ Vector3 Level::GridToWorld(int x, int y) const
     return result;
 }
 
-Vector2 Level::WorldToGrid(Vector3 worldPos) const
+GridPos Level::WorldToGrid(Vector3 worldPos) const
 {
-    float gridX = worldPos.x;
-    float gridY = worldPos.z;
-    return {gridX, gridY};
+    return {static_cast<int>(std::lround(worldPos.x)), static_cast<int>(std::lround(worldPos.z))};
 }
 
 int Level::GetWidth() const
@@ -11,7 +11,15 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
 #include <raylib.h>
+#include "Bitboard.hpp"
+#include "CellIdMap.hpp"
+#include "GridPos.hpp"
+#include "Zobrist.hpp"
+#include "LevelParser.hpp"
 
 enum class TileType {
     WALL,
@@ -20,19 +28,19 @@ enum class TileType {
     PLAYER_START
 };
 
-struct Tile {
-    TileType type;
-    Vector3 position;
-    bool hasBox = false;
-    bool isTarget = false;
+enum CellFlag : uint8_t {
+    CELL_WALL = 1 << 0,
+    CELL_TARGET = 1 << 1,
+    CELL_BOX = 1 << 2,
+    CELL_START = 1 << 3
 };
 
 struct LevelData {
     std::string name;
     int width;
     int height;
-    Vector2 playerStart;
-    std::vector<std::vector<Tile>> grid;
+    GridPos playerStart;
+    std::vector<uint8_t> cells; // row-major, one CellFlag mask per tile
     int totalBoxes;
     int boxesOnTargets;
 };
@@ -41,34 +49,67 @@ class Level {
 private:
     LevelData data;
     bool isCompleted;
-    std::vector<Vector2> boxPositions;
-    std::vector<Vector2> targetPositions;
+    std::vector<GridPos> boxPositions; // initial layout, never modified after load
+    std::vector<GridPos> targetPositions;
+    Bitboard wallBits;
+    Bitboard targetBits;
+    Bitboard boxBits;
+    CellIdMap cellBoxIds;
+    std::vector<GridPos> boxCells;
+    uint64_t boxHash;
+    mutable Bitboard regionVisited;
+    mutable std::vector<size_t> regionCells;
+    std::string loadError;
 
     void InitializeGrid();
-    void ParseGridFromStrings(const std::vector<std::string> &gridStrings);
+    void ParseGridFromStrings(const std::vector<std::string_view> &gridStrings);
     void CountBoxesAndTargets();
+    void BuildBitboards();
+    void ResetBoxes();
 
 public:
     Level();
     ~Level();
 
     bool LoadFromFile(const std::string &filename);
-    bool LoadFromJSON(const std::string &jsonContent);
+    bool LoadFromJSON(std::string_view jsonContent);
+    bool LoadFromSource(const LevelSource &source);
     void Reset();
 
     const LevelData& GetData() const { return data; }
+    const std::string& GetLoadError() const { return loadError; }
+    size_t Index(int x, int y) const { return static_cast<size_t>(y) * data.width + x; }
+    size_t Index(GridPos pos) const { return Index(pos.x, pos.y); }
     bool IsCompleted() const { return isCompleted; }
+    uint8_t GetCell(int x, int y) const;
+    const std::vector<uint8_t>& GetCells() const { return data.cells; }
+    const Bitboard& GetWallBits() const { return wallBits; }
+    const Bitboard& GetTargetBits() const { return targetBits; }
+    const Bitboard& GetBoxBits() const { return boxBits; }
     TileType GetTileType(int x, int y) const;
     bool CanMoveToTile(int x, int y) const;
+    bool CanMoveToTile(GridPos pos) const { return CanMoveToTile(pos.x, pos.y); }
     bool HasBox(int x, int y) const;
+    bool HasBox(GridPos pos) const { return HasBox(pos.x, pos.y); }
     bool IsTarget(int x, int y) const;
+    bool IsTarget(GridPos pos) const { return IsTarget(pos.x, pos.y); }
     bool IsValidPosition(int x, int y) const;
-    void MoveBox(int fromX, int fromY, int toX, int toY);
+    bool IsValidPosition(GridPos pos) const { return IsValidPosition(pos.x, pos.y); }
+    int MoveBox(int fromX, int fromY, int toX, int toY);
+    int MoveBox(GridPos from, GridPos to) { return MoveBox(from.x, from.y, to.x, to.y); }
+    int GetBoxId(GridPos pos) const;
+    int GetBoxCount() const { return static_cast<int>(boxCells.size()); }
+    GridPos GetBoxPosition(int boxId) const { return boxCells[boxId]; }
+    uint64_t GetBoxHash() const { return boxHash; }
+    uint64_t GetStateHash(GridPos player) const;
+    uint64_t GetNormalizedStateHash(GridPos player) const;
+    GridPos NormalizePlayerPosition(GridPos player) const;
     void CheckCompletion();
     void PlaceBox(int x, int y);
     void RemoveBox(int x, int y);
     Vector3 GridToWorld(int x, int y) const;
-    Vector2 WorldToGrid(Vector3 worldPos) const;
+    Vector3 GridToWorld(GridPos pos) const { return GridToWorld(pos.x, pos.y); }
+    GridPos WorldToGrid(Vector3 worldPos) const;
     int GetWidth() const;
     int GetHeight() const;
 };
@@ -0,0 +1,157 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelCollection
+*/
+
+#include "LevelCollection.hpp"
+#include "Level.hpp"
+#include "LevelParser.hpp"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <cctype>
+
+LevelCollection::LevelCollection()
+{
+}
+
+bool LevelCollection::IsCollectionFile(const std::string &filename)
+{
+    std::string extension = std::filesystem::path(filename).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+    return extension == ".xsb" || extension == ".sok" || extension == ".txt";
+}
+
+bool LevelCollection::IsBoardLine(std::string_view line)
+{
+    // '-' and '_' are the floor aliases some collections use for leading space
+    bool hasWall = false;
+    for (char c : line) {
+        switch (c) {
+            case '#':
+                hasWall = true;
+                break;
+            case ' ': case '-': case '_': case '@': case '+':
+            case '$': case '*': case '.':
+                break;
+            default:
+                return false;
+        }
+    }
+    return hasWall;
+}
+
+static std::string_view TrimLine(std::string_view line)
+{
+    while (!line.empty() && (line.back() == '\r' || line.back() == ' ' || line.back() == '\t'))
+        line.remove_suffix(1);
+    return line;
+}
+
+static std::string_view MetadataText(std::string_view line)
+{
+    while (!line.empty() && (line.front() == ';' || line.front() == ' ' || line.front() == '\t'))
+        line.remove_prefix(1);
+    return line;
+}
+
+bool LevelCollection::Open(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open level collection: " << filename << std::endl;
+        return false;
+    }
+    path = filename;
+    entries.clear();
+    std::string stem = std::filesystem::path(filename).stem().string();
+    std::string line;
+    std::string lastText;
+    uint64_t offset = 0;
+    bool inBoard = false;
+    bool awaitingTitle = false;
+    CollectionEntry current = {0, 0, 0, 0, ""};
+    auto finishBoard = [&]() {
+        if (current.title.empty())
+            current.title = lastText.empty() ? stem + " #" + std::to_string(entries.size() + 1) : lastText;
+        entries.push_back(current);
+        lastText.clear();
+        inBoard = false;
+    };
+    while (std::getline(file, line)) {
+        uint64_t lineOffset = offset;
+        offset += line.size() + (file.eof() ? 0 : 1);
+        std::string_view text = TrimLine(line);
+        if (!text.empty() && IsBoardLine(text)) {
+            if (!inBoard) {
+                current = {lineOffset, 0, 0, 0, ""};
+                inBoard = true;
+            }
+            current.length = static_cast<uint32_t>(offset - current.offset);
+            current.width = std::max(current.width, static_cast<int>(text.size()));
+            current.height++;
+            continue;
+        }
+        if (inBoard) {
+            // SOK files name a board on the "Title:" line right after it
+            awaitingTitle = true;
+            finishBoard();
+        }
+        std::string_view meta = MetadataText(text);
+        if (meta.empty())
+            continue;
+        if (meta.substr(0, 6) == "Title:" || meta.substr(0, 6) == "title:") {
+            std::string_view title = MetadataText(meta.substr(6));
+            if (awaitingTitle && !entries.empty())
+                entries.back().title.assign(title.data(), title.size());
+            else
+                lastText.assign(title.data(), title.size());
+            awaitingTitle = false;
+            continue;
+        }
+        if (meta.find(':') == std::string_view::npos)
+            lastText.assign(meta.data(), meta.size());
+        awaitingTitle = false;
+    }
+    if (inBoard)
+        finishBoard();
+    std::cout << "Indexed " << entries.size() << " level(s) from collection: " << filename << std::endl;
+    return !entries.empty();
+}
+
+bool LevelCollection::LoadLevel(int index, Level &level, std::string &buffer) const
+{
+    if (index < 0 || index >= GetLevelCount()) {
+        std::cerr << "Error: Collection level " << index << " out of range" << std::endl;
+        return false;
+    }
+    const CollectionEntry &entry = entries[index];
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not reopen level collection: " << path << std::endl;
+        return false;
+    }
+    buffer.resize(entry.length);
+    file.seekg(static_cast<std::streamoff>(entry.offset));
+    if (!file.read(buffer.data(), entry.length)) {
+        std::cerr << "Error: Truncated level collection: " << path << std::endl;
+        return false;
+    }
+    LevelSource source;
+    source.name = entry.title;
+    source.width = entry.width;
+    source.height = entry.height;
+    std::string_view remaining = buffer;
+    while (!remaining.empty() && static_cast<int>(source.rows.size()) < entry.height) {
+        size_t newline = remaining.find('\n');
+        std::string_view row = TrimLine(remaining.substr(0, newline));
+        source.rows.push_back(row);
+        if (newline == std::string_view::npos)
+            break;
+        remaining.remove_prefix(newline + 1);
+    }
+    return level.LoadFromSource(source);
+}
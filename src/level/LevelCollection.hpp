@@ -0,0 +1,49 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelCollection
+*/
+
+#ifndef LEVELCOLLECTION_HPP_
+#define LEVELCOLLECTION_HPP_
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+class Level;
+
+struct CollectionEntry {
+    uint64_t offset;
+    uint32_t length;
+    int width;
+    int height;
+    std::string title;
+};
+
+// Multi-level XSB/SOK text file. Open() indexes every board in one streaming
+// pass; boards are only read back and parsed when a level is requested
+class LevelCollection {
+private:
+    std::string path;
+    std::vector<CollectionEntry> entries;
+    std::string readBuffer;
+
+public:
+    LevelCollection();
+
+    bool Open(const std::string &filename);
+    bool LoadLevel(int index, Level &level) { return LoadLevel(index, level, readBuffer); }
+    bool LoadLevel(int index, Level &level, std::string &buffer) const;
+    int GetLevelCount() const { return static_cast<int>(entries.size()); }
+    const CollectionEntry& GetEntry(int index) const { return entries[index]; }
+    const std::string& GetPath() const { return path; }
+
+    static bool IsCollectionFile(const std::string &filename);
+    static bool IsBoardLine(std::string_view line);
+};
+
+#endif /* !LEVELCOLLECTION_HPP_ */
@@ -0,0 +1,243 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelIndex
+*/
+
+#include "LevelIndex.hpp"
+#include "LevelLoader.hpp"
+#include "LevelPack.hpp"
+#include "LevelValidator.hpp"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+
+std::vector<LevelMeta> LevelIndex::entries;
+std::vector<StaleLevel> LevelIndex::staleLevels;
+std::string LevelIndex::indexPath = LevelIndex::DEFAULT_PATH;
+bool LevelIndex::dirty = false;
+
+static const char INDEX_MAGIC[4] = {'S', 'K', 'I', 'X'};
+
+template <typename T>
+static void WriteValue(std::ostream &out, const T &value)
+{
+    out.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool ReadValue(std::istream &in, T &value)
+{
+    return static_cast<bool>(in.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+static void WriteString(std::ostream &out, const std::string &value)
+{
+    uint16_t length = static_cast<uint16_t>(std::min<size_t>(value.size(), UINT16_MAX));
+    WriteValue(out, length);
+    out.write(value.data(), length);
+}
+
+static bool ReadString(std::istream &in, std::string &value)
+{
+    uint16_t length = 0;
+    if (!ReadValue(in, length))
+        return false;
+    value.resize(length);
+    return length == 0 || static_cast<bool>(in.read(&value[0], length));
+}
+
+int64_t LevelIndex::GetModifiedTime(const std::string &filename)
+{
+    std::error_code error;
+    auto time = std::filesystem::last_write_time(filename, error);
+    return error ? 0 : static_cast<int64_t>(time.time_since_epoch().count());
+}
+
+void LevelIndex::Describe(LevelMeta &meta, const std::string &name, int width, int height, int boxCount,
+                          uint64_t contentHash)
+{
+    meta.name = name;
+    meta.width = width;
+    meta.height = height;
+    meta.boxCount = boxCount;
+    if (meta.contentHash != contentHash) {
+        meta.bestMoves = -1;
+        meta.bestTime = 0.0f;
+    }
+    meta.contentHash = contentHash;
+    dirty = true;
+}
+
+bool LevelIndex::ReadIndex(const std::string &filename, std::vector<LevelMeta> &out)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open())
+        return false;
+    char magic[4];
+    uint32_t version = 0;
+    uint32_t count = 0;
+    if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, INDEX_MAGIC, sizeof(magic)) != 0 ||
+        !ReadValue(file, version) || version != VERSION || !ReadValue(file, count)) {
+        std::cerr << "Error: Ignoring unsupported level index: " << filename << std::endl;
+        return false;
+    }
+    out.clear();
+    for (uint32_t i = 0; i < count; ++i) {
+        LevelMeta meta;
+        int32_t fields[4];
+        if (!ReadString(file, meta.key) || !ReadString(file, meta.name) || !ReadValue(file, fields) ||
+            !ReadValue(file, meta.contentHash) || !ReadValue(file, meta.modifiedTime) ||
+            !ReadValue(file, meta.bestTime)) {
+            std::cerr << "Error: Truncated level index: " << filename << std::endl;
+            return false;
+        }
+        meta.width = fields[0];
+        meta.height = fields[1];
+        meta.boxCount = fields[2];
+        meta.bestMoves = fields[3];
+        out.push_back(std::move(meta));
+    }
+    return true;
+}
+
+void LevelIndex::Load(const std::string &filename)
+{
+    indexPath = filename;
+    std::vector<LevelMeta> stored;
+    ReadIndex(filename, stored);
+    std::unordered_map<std::string, LevelMeta *> byKey;
+    for (auto &meta : stored)
+        byKey[meta.key] = &meta;
+    int total = LevelLoader::GetTotalLevels();
+    entries.assign(total, LevelMeta());
+    staleLevels.clear();
+    std::string lastPath;
+    int64_t lastTime = 0;
+    for (int i = 0; i < total; ++i) {
+        // Collection and pack entries share one file, so stat each file once
+        std::string path = LevelLoader::GetLevelPath(i);
+        if (path != lastPath) {
+            lastPath = path;
+            lastTime = GetModifiedTime(path);
+        }
+        LevelMeta &meta = entries[i];
+        auto found = byKey.find(LevelLoader::GetLevelFileName(i));
+        if (found != byKey.end() && found->second->modifiedTime == lastTime) {
+            meta = std::move(*found->second);
+            continue;
+        }
+        // The old hash and scores stay until Update sees the new content, and
+        // modifiedTime stays old so an unfinished refresh is retried next run
+        if (found != byKey.end()) {
+            meta = std::move(*found->second);
+        } else {
+            meta.key = LevelLoader::GetLevelFileName(i);
+            meta.name = LevelLoader::GetLevelName(i);
+        }
+        staleLevels.push_back({i, lastTime});
+    }
+    std::cout << "Level index: " << total << " level(s), " << staleLevels.size() << " to refresh" << std::endl;
+    dirty = stored.size() != entries.size();
+}
+
+void LevelIndex::Update()
+{
+    if (staleLevels.empty() || !LevelValidator::IsFinished())
+        return;
+    if (LevelValidator::GetLevelCount() != GetCount()) {
+        staleLevels.clear();
+        return;
+    }
+    for (const StaleLevel &stale : staleLevels) {
+        LevelMeta &meta = entries[stale.index];
+        const LevelReport *report = LevelValidator::GetReport(stale.index);
+        if (report && report->status.load(std::memory_order_acquire) != LevelStatus::LOAD_ERROR)
+            Describe(meta, report->name, report->width, report->height, report->boxCount, report->contentHash);
+        meta.modifiedTime = stale.modifiedTime;
+    }
+    std::cout << "Level index: refreshed " << staleLevels.size() << " level(s)" << std::endl;
+    staleLevels.clear();
+    dirty = true;
+}
+
+bool LevelIndex::Flush()
+{
+    if (!dirty)
+        return true;
+    if (!Save())
+        return false;
+    dirty = false;
+    return true;
+}
+
+bool LevelIndex::Save()
+{
+    // Write next to the real file and rename, so a crash never leaves a
+    // half-written index behind
+    std::string temporary = indexPath + ".tmp";
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "Error: Could not write level index: " << temporary << std::endl;
+            return false;
+        }
+        file.write(INDEX_MAGIC, sizeof(INDEX_MAGIC));
+        WriteValue(file, VERSION);
+        WriteValue(file, static_cast<uint32_t>(entries.size()));
+        for (const LevelMeta &meta : entries) {
+            int32_t fields[4] = {meta.width, meta.height, meta.boxCount, meta.bestMoves};
+            WriteString(file, meta.key);
+            WriteString(file, meta.name);
+            WriteValue(file, fields);
+            WriteValue(file, meta.contentHash);
+            WriteValue(file, meta.modifiedTime);
+            WriteValue(file, meta.bestTime);
+        }
+        if (!file) {
+            std::cerr << "Error: Could not write level index: " << temporary << std::endl;
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, indexPath, error);
+    if (error) {
+        std::cerr << "Error: Could not replace level index: " << indexPath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+const LevelMeta *LevelIndex::GetEntry(int index)
+{
+    if (index < 0 || index >= static_cast<int>(entries.size()))
+        return nullptr;
+    return &entries[index];
+}
+
+void LevelIndex::UpdateLevel(int index, const Level &level)
+{
+    if (index < 0 || index >= static_cast<int>(entries.size()))
+        return;
+    LevelMeta &meta = entries[index];
+    Describe(meta, level.GetData().name, level.GetWidth(), level.GetHeight(), level.GetBoxCount(),
+             LevelPack::HashLevel(level));
+    meta.modifiedTime = GetModifiedTime(LevelLoader::GetLevelPath(index));
+}
+
+bool LevelIndex::RecordScore(int index, int moves, float time)
+{
+    if (index < 0 || index >= static_cast<int>(entries.size()))
+        return false;
+    LevelMeta &meta = entries[index];
+    bool better = meta.bestMoves < 0 || moves < meta.bestMoves || (moves == meta.bestMoves && time < meta.bestTime);
+    if (!better)
+        return false;
+    meta.bestMoves = moves;
+    meta.bestTime = time;
+    dirty = true;
+    return true;
+}
@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelIndex
+*/
+
+#ifndef LEVELINDEX_HPP_
+#define LEVELINDEX_HPP_
+#pragma once
+
+#include "Level.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct LevelMeta {
+    std::string key; // LevelLoader file name, "path#n" for container entries
+    std::string name;
+    int width = 0;
+    int height = 0;
+    int boxCount = 0;
+    uint64_t contentHash = 0;
+    int64_t modifiedTime = 0;
+    int bestMoves = -1;
+    float bestTime = 0.0f;
+};
+
+struct StaleLevel {
+    int index;
+    int64_t modifiedTime;
+};
+
+// On-disk summary of every level in LevelLoader order, so menus never have
+// to open a level file. Entries whose file's mtime changed are refreshed
+// from LevelValidator's results instead of being parsed again here; best
+// scores survive as long as the level content hash does. Changes are only
+// written by Flush, never from inside a frame that changed them
+class LevelIndex {
+private:
+    static std::vector<LevelMeta> entries;
+    static std::vector<StaleLevel> staleLevels;
+    static std::string indexPath;
+    static bool dirty;
+
+    static bool ReadIndex(const std::string &filename, std::vector<LevelMeta> &out);
+    static int64_t GetModifiedTime(const std::string &filename);
+    static void Describe(LevelMeta &meta, const std::string &name, int width, int height, int boxCount,
+                         uint64_t contentHash);
+    static bool Save();
+
+public:
+    static constexpr const char *DEFAULT_PATH = "assets/level_index.dat";
+    static constexpr uint32_t VERSION = 2;
+
+    static void Load(const std::string &filename = DEFAULT_PATH);
+    static void Update();
+    static bool Flush();
+    static int GetCount() { return static_cast<int>(entries.size()); }
+    static const LevelMeta *GetEntry(int index);
+    static void UpdateLevel(int index, const Level &level);
+    static bool RecordScore(int index, int moves, float time);
+};
+
+#endif /* !LEVELINDEX_HPP_ */
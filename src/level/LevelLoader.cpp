@@ -11,13 +11,118 @@
 #include <filesystem>
 #include <algorithm>
 #include <sstream>
+#include <cctype>
 
-std::vector<std::string> LevelLoader::levelFiles;
+std::vector<LevelEntry> LevelLoader::levelFiles;
+std::vector<std::unique_ptr<LevelCollection>> LevelLoader::collections;
+std::vector<std::unique_ptr<LevelPack>> LevelLoader::packs;
 int LevelLoader::currentLevelIndex = 0;
 
+bool LevelLoader::NaturalLess(const std::string &a, const std::string &b)
+{
+    // Compare digit runs by value so level2 sorts before level10. The shared
+    // prefix is skipped up to the start of any digit run it ends in
+    size_t i = std::mismatch(a.begin(), a.begin() + std::min(a.size(), b.size()), b.begin()).first - a.begin();
+    while (i > 0 && std::isdigit(static_cast<unsigned char>(a[i - 1])))
+        i--;
+    size_t j = i;
+    while (i < a.size() && j < b.size()) {
+        if (std::isdigit(static_cast<unsigned char>(a[i])) && std::isdigit(static_cast<unsigned char>(b[j]))) {
+            size_t endA = i;
+            size_t endB = j;
+            while (endA < a.size() && std::isdigit(static_cast<unsigned char>(a[endA]))) endA++;
+            while (endB < b.size() && std::isdigit(static_cast<unsigned char>(b[endB]))) endB++;
+            size_t startA = a.find_first_not_of('0', i);
+            size_t startB = b.find_first_not_of('0', j);
+            startA = std::min(startA, endA);
+            startB = std::min(startB, endB);
+            if (endA - startA != endB - startB)
+                return endA - startA < endB - startB;
+            int cmp = a.compare(startA, endA - startA, b, startB, endB - startB);
+            if (cmp != 0)
+                return cmp < 0;
+            i = endA;
+            j = endB;
+            continue;
+        }
+        if (a[i] != b[j])
+            return a[i] < b[j];
+        i++;
+        j++;
+    }
+    return a.size() - i < b.size() - j;
+}
+
+void LevelLoader::ScanDirectory(const std::string &levelDirectory)
+{
+    std::vector<LevelEntry> files;
+    for (const auto& entry : std::filesystem::directory_iterator(levelDirectory)) {
+        if (!entry.is_regular_file())
+            continue;
+        std::string filename = entry.path().string();
+        if (entry.path().extension() == ".json")
+            files.push_back({std::move(filename), LevelSourceKind::JSON, -1, 0});
+        else if (LevelPack::IsPackFile(filename))
+            files.push_back({std::move(filename), LevelSourceKind::PACK, -1, 0});
+        else if (LevelCollection::IsCollectionFile(filename))
+            files.push_back({std::move(filename), LevelSourceKind::COLLECTION, -1, 0});
+    }
+    std::sort(files.begin(), files.end(), [](const LevelEntry &a, const LevelEntry &b) {
+        return NaturalLess(a.path, b.path);
+    });
+    levelFiles.reserve(levelFiles.size() + files.size());
+    for (auto &file : files) {
+        if (file.kind == LevelSourceKind::JSON)
+            levelFiles.push_back(std::move(file));
+        else
+            AddFile(file.path, file.kind);
+    }
+}
+
+void LevelLoader::AddFile(const std::string &filename, LevelSourceKind kind)
+{
+    if (kind == LevelSourceKind::PACK) {
+        auto pack = std::make_unique<LevelPack>();
+        if (!pack->Open(filename))
+            return;
+        int packId = static_cast<int>(packs.size());
+        for (int i = 0; i < pack->GetLevelCount(); ++i)
+            levelFiles.push_back({filename, LevelSourceKind::PACK, packId, i});
+        packs.push_back(std::move(pack));
+    } else if (kind == LevelSourceKind::COLLECTION) {
+        auto collection = std::make_unique<LevelCollection>();
+        if (!collection->Open(filename))
+            return;
+        int collectionId = static_cast<int>(collections.size());
+        for (int i = 0; i < collection->GetLevelCount(); ++i)
+            levelFiles.push_back({filename, LevelSourceKind::COLLECTION, collectionId, i});
+        collections.push_back(std::move(collection));
+    } else {
+        levelFiles.push_back({filename, LevelSourceKind::JSON, -1, 0});
+    }
+}
+
+bool LevelLoader::LoadLevelPack(const std::string &filename)
+{
+    levelFiles.clear();
+    collections.clear();
+    packs.clear();
+    currentLevelIndex = 0;
+    AddFile(filename, LevelSourceKind::PACK);
+    if (!packs.empty() && !packs.back()->IsUpToDate()) {
+        levelFiles.clear();
+        packs.clear();
+        return false;
+    }
+    std::cout << "Found " << levelFiles.size() << " levels in pack: " << filename << std::endl;
+    return !levelFiles.empty();
+}
+
 bool LevelLoader::LoadLevelList(const std::string &levelDirectory)
 {
     levelFiles.clear();
+    collections.clear();
+    packs.clear();
     currentLevelIndex = 0;
     std::cout << "Loading level list from: " << levelDirectory << std::endl;
     try {
@@ -25,28 +130,19 @@ bool LevelLoader::LoadLevelList(const std::string &levelDirectory)
             std::cout << "Level directory doesn't exist, creating test levels..." << std::endl;
             CreateTestLevelFiles(levelDirectory);
         }
-        for (const auto& entry : std::filesystem::directory_iterator(levelDirectory)) {
-            if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                levelFiles.push_back(entry.path().string());
-            }
-        }
-        std::sort(levelFiles.begin(), levelFiles.end());
-        std::cout << "Found " << levelFiles.size() << " level files:" << std::endl;
-        for (size_t i = 0; i < levelFiles.size(); ++i) {
-            std::cout << "  " << i << ": " << levelFiles[i] << std::endl;
-        }
+        ScanDirectory(levelDirectory);
+        std::cout << "Found " << levelFiles.size() << " levels (" << collections.size()
+                  << " collection file(s), " << packs.size() << " pack(s))" << std::endl;
         return !levelFiles.empty();
     } catch (const std::exception& e) {
         std::cerr << "Error loading level list: " << e.what() << std::endl;
         std::cout << "Creating fallback test levels..." << std::endl;
         CreateTestLevelFiles(levelDirectory);
         try {
-            for (const auto& entry : std::filesystem::directory_iterator(levelDirectory)) {
-                if (entry.is_regular_file() && entry.path().extension() == ".json") {
-                    levelFiles.push_back(entry.path().string());
-                }
-            }
-            std::sort(levelFiles.begin(), levelFiles.end());
+            levelFiles.clear();
+            collections.clear();
+            packs.clear();
+            ScanDirectory(levelDirectory);
         } catch (...) {
             return false;
         }
@@ -58,21 +154,53 @@ bool LevelLoader::LoadLevel(Level &level, int levelIndex)
 {
     if (levelIndex < 0 || levelIndex >= static_cast<int>(levelFiles.size())) {
         std::cerr << "Error: Level index " << levelIndex << " out of range (0-"
-                  << (levelFiles.size() - 1) << ")" << std::endl;
+                  << (static_cast<int>(levelFiles.size()) - 1) << ")" << std::endl;
         return false;
     }
     currentLevelIndex = levelIndex;
-    std::string filename = levelFiles[levelIndex];
-    std::cout << "Loading level " << levelIndex << ": " << filename << std::endl;
-    if (level.LoadFromFile(filename)) {
-        std::cout << "Successfully loaded level: " << level.GetData().name << std::endl;
+    const LevelEntry &entry = levelFiles[levelIndex];
+    std::cout << "Loading level " << levelIndex << ": " << GetLevelFileName(levelIndex) << std::endl;
+    bool loaded = false;
+    switch (entry.kind) {
+        case LevelSourceKind::PACK:
+            loaded = packs[entry.container]->LoadLevel(entry.containerIndex, level);
+            break;
+        case LevelSourceKind::COLLECTION:
+            loaded = collections[entry.container]->LoadLevel(entry.containerIndex, level);
+            break;
+        case LevelSourceKind::JSON:
+            loaded = level.LoadFromFile(entry.path);
+            break;
+    }
+    if (loaded) {
+        const LevelData &data = level.GetData();
+        std::cout << "Successfully loaded level: " << data.name << " (" << data.width << "x"
+                  << data.height << ", " << data.totalBoxes << " boxes)" << std::endl;
         return true;
     } else {
-        std::cerr << "Failed to load level: " << filename << std::endl;
+        std::cerr << "Failed to load level: " << GetLevelFileName(levelIndex) << std::endl;
         return false;
     }
 }
 
+// Thread-safe variant used by background workers: no logging, no shared
+// scratch buffers and the current level index is left untouched
+bool LevelLoader::ReadLevel(Level &level, int levelIndex, std::string &buffer)
+{
+    if (levelIndex < 0 || levelIndex >= static_cast<int>(levelFiles.size()))
+        return false;
+    const LevelEntry &entry = levelFiles[levelIndex];
+    switch (entry.kind) {
+        case LevelSourceKind::PACK:
+            return packs[entry.container]->LoadLevel(entry.containerIndex, level, buffer);
+        case LevelSourceKind::COLLECTION:
+            return collections[entry.container]->LoadLevel(entry.containerIndex, level, buffer);
+        case LevelSourceKind::JSON:
+            return LevelParser::ReadFile(entry.path, buffer) && level.LoadFromJSON(buffer);
+    }
+    return false;
+}
+
 bool LevelLoader::LoadNextLevel(Level &level)
 {
     if (!HasNextLevel()) {
@@ -102,10 +230,20 @@ bool LevelLoader::ReloadCurrentLevel(Level &level)
 
 std::string LevelLoader::GetCurrentLevelName()
 {
-    if (currentLevelIndex < 0 || currentLevelIndex >= static_cast<int>(levelFiles.size())) {
+    return GetLevelName(currentLevelIndex);
+}
+
+std::string LevelLoader::GetLevelName(int index)
+{
+    if (index < 0 || index >= static_cast<int>(levelFiles.size())) {
         return "Unknown";
     }
-    std::string filename = levelFiles[currentLevelIndex];
+    const LevelEntry &entry = levelFiles[index];
+    if (entry.kind == LevelSourceKind::PACK)
+        return std::string(packs[entry.container]->GetName(entry.containerIndex));
+    if (entry.kind == LevelSourceKind::COLLECTION)
+        return collections[entry.container]->GetEntry(entry.containerIndex).title;
+    std::string filename = entry.path;
     size_t lastSlash = filename.find_last_of("/\\");
     if (lastSlash != std::string::npos) {
         filename = filename.substr(lastSlash + 1);
@@ -122,7 +260,53 @@ std::string LevelLoader::GetLevelFileName(int index)
     if (index < 0 || index >= static_cast<int>(levelFiles.size())) {
         return "";
     }
-    return levelFiles[index];
+    const LevelEntry &entry = levelFiles[index];
+    if (entry.kind != LevelSourceKind::JSON)
+        return entry.path + "#" + std::to_string(entry.containerIndex + 1);
+    return entry.path;
+}
+
+std::string LevelLoader::GetLevelPath(int index)
+{
+    if (index < 0 || index >= static_cast<int>(levelFiles.size()))
+        return "";
+    return levelFiles[index].path;
+}
+
+int LevelLoader::FindLevelFile(const std::string &path)
+{
+    std::filesystem::path wanted = std::filesystem::path(path).lexically_normal();
+    for (size_t i = 0; i < levelFiles.size(); ++i) {
+        if (levelFiles[i].kind == LevelSourceKind::JSON &&
+            std::filesystem::path(levelFiles[i].path).lexically_normal() == wanted)
+            return static_cast<int>(i);
+    }
+    return -1;
+}
+
+// Levels cooked into a pack report the file they were cooked from, so the
+// same level can be found again once the loose files are loaded instead
+std::string LevelLoader::GetLevelSource(int index)
+{
+    if (index < 0 || index >= static_cast<int>(levelFiles.size()))
+        return "";
+    const LevelEntry &entry = levelFiles[index];
+    if (entry.kind == LevelSourceKind::PACK) {
+        std::string_view source = packs[entry.container]->GetSourceName(entry.containerIndex);
+        if (!source.empty())
+            return std::string(source);
+    }
+    return GetLevelFileName(index);
+}
+
+int LevelLoader::FindLevel(const std::string &fileName)
+{
+    std::filesystem::path wanted = std::filesystem::path(fileName).lexically_normal();
+    for (int i = 0; i < GetTotalLevels(); ++i) {
+        if (std::filesystem::path(GetLevelFileName(i)).lexically_normal() == wanted)
+            return i;
+    }
+    return -1;
 }
 
 bool LevelLoader::HasNextLevel()
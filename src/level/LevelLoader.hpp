@@ -10,24 +10,52 @@
 #pragma once
 
 #include "Level.hpp"
+#include "LevelCollection.hpp"
+#include "LevelPack.hpp"
 #include <vector>
 #include <string>
+#include <memory>
+
+enum class LevelSourceKind {
+    JSON,
+    COLLECTION,
+    PACK
+};
+
+struct LevelEntry {
+    std::string path;
+    LevelSourceKind kind;
+    int container; // index into collections or packs, unused for JSON
+    int containerIndex;
+};
 
 class LevelLoader {
 private:
-    static std::vector<std::string> levelFiles;
+    static std::vector<LevelEntry> levelFiles;
+    static std::vector<std::unique_ptr<LevelCollection>> collections;
+    static std::vector<std::unique_ptr<LevelPack>> packs;
     static int currentLevelIndex;
+    static void ScanDirectory(const std::string &levelDirectory);
+    static void AddFile(const std::string &filename, LevelSourceKind kind);
+    static bool NaturalLess(const std::string &a, const std::string &b);
 
 public:
     static bool LoadLevelList(const std::string &levelDirectory = "assets/levels/");
+    static bool LoadLevelPack(const std::string &filename);
     static bool LoadLevel(Level &level, int levelIndex);
+    static bool ReadLevel(Level &level, int levelIndex, std::string &buffer);
     static bool LoadNextLevel(Level &level);
     static bool LoadPreviousLevel(Level &level);
     static bool ReloadCurrentLevel(Level &level);
     static int GetCurrentLevelIndex() { return currentLevelIndex; }
     static int GetTotalLevels() { return static_cast<int>(levelFiles.size()); }
     static std::string GetCurrentLevelName();
+    static std::string GetLevelName(int index);
     static std::string GetLevelFileName(int index);
+    static std::string GetLevelPath(int index);
+    static int FindLevelFile(const std::string &path);
+    static std::string GetLevelSource(int index);
+    static int FindLevel(const std::string &fileName);
     static bool HasNextLevel();
     static bool HasPreviousLevel();
     static void SetCurrentLevel(int index);
@@ -0,0 +1,302 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelPack
+*/
+
+#include "LevelPack.hpp"
+#include "Level.hpp"
+#include "LevelParser.hpp"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+static const char PACK_MAGIC[4] = {'S', 'K', 'P', 'K'};
+
+LevelPack::LevelPack()
+    : mapping(nullptr)
+    , mappingSize(0)
+    , header(nullptr)
+    , index(nullptr)
+    , sources(nullptr)
+{
+}
+
+LevelPack::~LevelPack()
+{
+    Close();
+}
+
+bool LevelPack::IsPackFile(const std::string &filename)
+{
+    return std::filesystem::path(filename).extension() == ".pack";
+}
+
+uint64_t LevelPack::HashCells(const uint8_t *cells, size_t size, int width, int height)
+{
+    // FNV-1a over the dimensions and the packed cells
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    auto mix = [&hash](uint8_t byte) {
+        hash ^= byte;
+        hash *= 0x100000001B3ULL;
+    };
+    for (int shift = 0; shift < 32; shift += 8) {
+        mix(static_cast<uint8_t>(width >> shift));
+        mix(static_cast<uint8_t>(height >> shift));
+    }
+    for (size_t i = 0; i < size; ++i)
+        mix(cells[i]);
+    return hash;
+}
+
+bool LevelPack::Open(const std::string &filename)
+{
+    Close();
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "Error: Could not open level pack: " << filename << std::endl;
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(PackHeader)) {
+        std::cerr << "Error: Level pack too small: " << filename << std::endl;
+        close(fd);
+        return false;
+    }
+    void *data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        std::cerr << "Error: Could not map level pack: " << filename << std::endl;
+        return false;
+    }
+    mapping = static_cast<const uint8_t *>(data);
+    mappingSize = static_cast<size_t>(info.st_size);
+    header = reinterpret_cast<const PackHeader *>(mapping);
+    if (std::memcmp(header->magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0 || header->version != VERSION) {
+        std::cerr << "Error: Not a supported level pack: " << filename << std::endl;
+        Close();
+        return false;
+    }
+    uint64_t indexEnd = header->indexOffset + static_cast<uint64_t>(header->levelCount) * sizeof(PackIndexEntry);
+    uint64_t sourcesEnd = indexEnd + static_cast<uint64_t>(header->sourceCount) * sizeof(PackSource);
+    if (header->fileSize != mappingSize || header->indexOffset % alignof(PackIndexEntry) != 0 || sourcesEnd > mappingSize) {
+        std::cerr << "Error: Corrupted level pack index: " << filename << std::endl;
+        Close();
+        return false;
+    }
+    index = reinterpret_cast<const PackIndexEntry *>(mapping + header->indexOffset);
+    sources = reinterpret_cast<const PackSource *>(mapping + indexEnd);
+    path = filename;
+    std::cout << "Mapped " << header->levelCount << " level(s) from pack: " << filename << std::endl;
+    return true;
+}
+
+void LevelPack::Close()
+{
+    if (mapping)
+        munmap(const_cast<uint8_t *>(mapping), mappingSize);
+    mapping = nullptr;
+    mappingSize = 0;
+    header = nullptr;
+    index = nullptr;
+    sources = nullptr;
+}
+
+std::string_view LevelPack::GetString(uint32_t offset, uint32_t length) const
+{
+    if (static_cast<uint64_t>(offset) + length > mappingSize)
+        return {};
+    return {reinterpret_cast<const char *>(mapping + offset), length};
+}
+
+std::string_view LevelPack::GetName(int levelIndex) const
+{
+    return GetString(index[levelIndex].nameOffset, index[levelIndex].nameLength);
+}
+
+std::string_view LevelPack::GetSourceName(int levelIndex) const
+{
+    return GetString(index[levelIndex].sourceOffset, index[levelIndex].sourceLength);
+}
+
+bool LevelPack::IsUpToDate() const
+{
+    for (uint32_t i = 0; header && i < header->sourceCount; ++i) {
+        std::string sourcePath(GetString(sources[i].pathOffset, sources[i].pathLength));
+        PackSource current;
+        if (!StampSource(sourcePath, current)) {
+            std::cout << "Level pack " << path << " is stale: " << sourcePath << " is missing" << std::endl;
+            return false;
+        }
+        if (current.modifiedTime != sources[i].modifiedTime || current.fileSize != sources[i].fileSize) {
+            std::cout << "Level pack " << path << " is stale: " << sourcePath << " changed" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool LevelPack::LoadLevel(int levelIndex, Level &level, std::string &buffer) const
+{
+    if (levelIndex < 0 || levelIndex >= GetLevelCount()) {
+        std::cerr << "Error: Pack level " << levelIndex << " out of range" << std::endl;
+        return false;
+    }
+    const PackIndexEntry &entry = index[levelIndex];
+    size_t cellCount = static_cast<size_t>(entry.width) * entry.height;
+    if (entry.cellBytes != (cellCount * 3 + 7) / 8 || entry.cellOffset + entry.cellBytes > mappingSize) {
+        std::cerr << "Error: Corrupted pack entry " << levelIndex << " in " << path << std::endl;
+        return false;
+    }
+    const uint8_t *cells = mapping + entry.cellOffset;
+    if (HashCells(cells, entry.cellBytes, entry.width, entry.height) != entry.contentHash) {
+        std::cerr << "Error: Content hash mismatch for pack entry " << levelIndex << " in " << path << std::endl;
+        return false;
+    }
+    buffer.resize(cellCount);
+    for (size_t i = 0; i < cellCount; ++i) {
+        size_t bit = i * 3;
+        unsigned int window = cells[bit >> 3];
+        if ((bit >> 3) + 1 < entry.cellBytes)
+            window |= static_cast<unsigned int>(cells[(bit >> 3) + 1]) << 8;
+        buffer[i] = CELL_CHARS[(window >> (bit & 7)) & 0x7];
+    }
+    LevelSource source;
+    std::string_view name = GetName(levelIndex);
+    source.name.assign(name.data(), name.size());
+    source.width = entry.width;
+    source.height = entry.height;
+    source.playerStart = {entry.playerX, entry.playerY};
+    source.rows.reserve(entry.height);
+    std::string_view decoded = buffer;
+    for (int y = 0; y < entry.height; ++y)
+        source.rows.push_back(decoded.substr(static_cast<size_t>(y) * entry.width, entry.width));
+    return level.LoadFromSource(source);
+}
+
+static uint8_t EncodeCell(const Level &level, int x, int y)
+{
+    uint8_t cell = level.GetCell(x, y);
+    GridPos start = level.GetData().playerStart;
+    bool target = (cell & CELL_TARGET) != 0;
+    if (cell & CELL_WALL)
+        return 1;
+    if (start.x == x && start.y == y)
+        return target ? 6 : 5;
+    if (cell & CELL_BOX)
+        return target ? 4 : 3;
+    return target ? 2 : 0;
+}
+
+static size_t PackedSize(int width, int height)
+{
+    return (static_cast<size_t>(width) * height * 3 + 7) / 8;
+}
+
+// out must hold PackedSize() zeroed bytes
+static void PackCells(const Level &level, uint8_t *out)
+{
+    const LevelData &data = level.GetData();
+    size_t cellCount = static_cast<size_t>(data.width) * data.height;
+    for (size_t c = 0; c < cellCount; ++c) {
+        uint8_t code = EncodeCell(level, static_cast<int>(c % data.width), static_cast<int>(c / data.width));
+        size_t bit = c * 3;
+        out[bit >> 3] |= static_cast<uint8_t>(code << (bit & 7));
+        if ((bit & 7) > 5)
+            out[(bit >> 3) + 1] |= static_cast<uint8_t>(code >> (8 - (bit & 7)));
+    }
+}
+
+uint64_t LevelPack::HashLevel(const Level &level)
+{
+    const LevelData &data = level.GetData();
+    std::vector<uint8_t> cells(PackedSize(data.width, data.height), 0);
+    PackCells(level, cells.data());
+    return HashCells(cells.data(), cells.size(), data.width, data.height);
+}
+
+bool LevelPack::StampSource(const std::string &filename, PackSource &source)
+{
+    std::error_code error;
+    auto time = std::filesystem::last_write_time(filename, error);
+    if (error)
+        return false;
+    source.modifiedTime = static_cast<int64_t>(time.time_since_epoch().count());
+    source.fileSize = std::filesystem::is_directory(filename, error) ? 0 : std::filesystem::file_size(filename, error);
+    return !error;
+}
+
+bool LevelPack::Write(const std::string &filename, const std::vector<const Level *> &levels,
+                      const std::vector<std::string> &levelSources, const std::vector<std::string> &sourceFiles)
+{
+    std::vector<PackIndexEntry> entries(levels.size());
+    std::vector<PackSource> sources(sourceFiles.size());
+    std::string strings;
+    std::vector<uint8_t> cells;
+    uint64_t indexOffset = sizeof(PackHeader);
+    uint64_t sourcesOffset = indexOffset + entries.size() * sizeof(PackIndexEntry);
+    uint64_t stringsOffset = sourcesOffset + sources.size() * sizeof(PackSource);
+    auto addString = [&](const std::string &value, uint32_t &offset, uint32_t &length) {
+        offset = static_cast<uint32_t>(stringsOffset + strings.size());
+        length = static_cast<uint32_t>(value.size());
+        strings += value;
+    };
+    for (size_t i = 0; i < levels.size(); ++i) {
+        const Level &level = *levels[i];
+        if (level.GetWidth() > 0xFFFF || level.GetHeight() > 0xFFFF) {
+            std::cerr << "Error: Level too large for pack: " << level.GetData().name << std::endl;
+            return false;
+        }
+        addString(level.GetData().name, entries[i].nameOffset, entries[i].nameLength);
+        addString(i < levelSources.size() ? levelSources[i] : std::string(), entries[i].sourceOffset,
+                  entries[i].sourceLength);
+    }
+    for (size_t i = 0; i < sourceFiles.size(); ++i) {
+        if (!StampSource(sourceFiles[i], sources[i])) {
+            std::cerr << "Error: Could not stat level source: " << sourceFiles[i] << std::endl;
+            return false;
+        }
+        addString(sourceFiles[i], sources[i].pathOffset, sources[i].pathLength);
+    }
+    uint64_t cellsOffset = stringsOffset + strings.size();
+    for (size_t i = 0; i < levels.size(); ++i) {
+        const Level &level = *levels[i];
+        const LevelData &data = level.GetData();
+        size_t start = cells.size();
+        cells.resize(start + PackedSize(data.width, data.height), 0);
+        PackCells(level, cells.data() + start);
+        PackIndexEntry &entry = entries[i];
+        entry.cellOffset = cellsOffset + start;
+        entry.cellBytes = static_cast<uint32_t>(cells.size() - start);
+        entry.contentHash = HashCells(cells.data() + start, entry.cellBytes, data.width, data.height);
+        entry.width = static_cast<uint16_t>(data.width);
+        entry.height = static_cast<uint16_t>(data.height);
+        entry.boxCount = static_cast<uint32_t>(level.GetBoxCount());
+        entry.playerX = static_cast<uint16_t>(data.playerStart.x);
+        entry.playerY = static_cast<uint16_t>(data.playerStart.y);
+    }
+    PackHeader header = {};
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = VERSION;
+    header.levelCount = static_cast<uint32_t>(levels.size());
+    header.sourceCount = static_cast<uint32_t>(sources.size());
+    header.indexOffset = indexOffset;
+    header.fileSize = cellsOffset + cells.size();
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not write level pack: " << filename << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char *>(entries.data()), entries.size() * sizeof(PackIndexEntry));
+    file.write(reinterpret_cast<const char *>(sources.data()), sources.size() * sizeof(PackSource));
+    file.write(strings.data(), strings.size());
+    file.write(reinterpret_cast<const char *>(cells.data()), cells.size());
+    return static_cast<bool>(file);
+}
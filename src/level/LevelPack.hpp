@@ -0,0 +1,103 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelPack
+*/
+
+#ifndef LEVELPACK_HPP_
+#define LEVELPACK_HPP_
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+class Level;
+
+// On-disk layout (little-endian): PackHeader, levelCount PackIndexEntry
+// records, sourceCount PackSource records, then the string blob and the cell
+// data. Cells are 3-bit codes (see LevelPack::CELL_CHARS) packed LSB-first,
+// row-major. Sources stamp every file the pack was cooked from
+struct PackHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t levelCount;
+    uint32_t sourceCount;
+    uint64_t indexOffset;
+    uint64_t fileSize;
+};
+
+struct PackIndexEntry {
+    uint64_t cellOffset;
+    uint64_t contentHash;
+    uint32_t cellBytes;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint16_t width;
+    uint16_t height;
+    uint32_t boxCount;
+    uint16_t playerX;
+    uint16_t playerY;
+    uint32_t sourceOffset; // LevelLoader file name the level was cooked from
+    uint32_t sourceLength;
+};
+
+struct PackSource {
+    int64_t modifiedTime;
+    uint64_t fileSize;
+    uint32_t pathOffset;
+    uint32_t pathLength;
+};
+
+static_assert(sizeof(PackHeader) == 32, "PackHeader layout must not change");
+static_assert(sizeof(PackIndexEntry) == 48, "PackIndexEntry layout must not change");
+static_assert(sizeof(PackSource) == 24, "PackSource layout must not change");
+
+class LevelPack {
+private:
+    std::string path;
+    const uint8_t *mapping;
+    size_t mappingSize;
+    const PackHeader *header;
+    const PackIndexEntry *index;
+    const PackSource *sources;
+    std::string decodeBuffer;
+
+    std::string_view GetString(uint32_t offset, uint32_t length) const;
+    static bool StampSource(const std::string &filename, PackSource &source);
+
+public:
+    static constexpr uint32_t VERSION = 2;
+    static constexpr const char *CELL_CHARS = " #.$*@+ ";
+
+    LevelPack();
+    ~LevelPack();
+    LevelPack(const LevelPack &) = delete;
+    LevelPack &operator=(const LevelPack &) = delete;
+
+    bool Open(const std::string &filename);
+    void Close();
+    bool IsOpen() const { return mapping != nullptr; }
+    bool LoadLevel(int levelIndex, Level &level) { return LoadLevel(levelIndex, level, decodeBuffer); }
+    bool LoadLevel(int levelIndex, Level &level, std::string &buffer) const;
+    int GetLevelCount() const { return header ? static_cast<int>(header->levelCount) : 0; }
+    const PackIndexEntry& GetEntry(int levelIndex) const { return index[levelIndex]; }
+    std::string_view GetName(int levelIndex) const;
+    std::string_view GetSourceName(int levelIndex) const;
+    bool IsUpToDate() const;
+    const std::string& GetPath() const { return path; }
+
+    static bool IsPackFile(const std::string &filename);
+    static uint64_t HashCells(const uint8_t *cells, size_t size, int width, int height);
+    // Same value Write stores as the entry's contentHash
+    static uint64_t HashLevel(const Level &level);
+    // levelSources names each level's origin, sourceFiles lists every file
+    // (and directory) whose change should make the pack stale
+    static bool Write(const std::string &filename, const std::vector<const Level *> &levels,
+                      const std::vector<std::string> &levelSources, const std::vector<std::string> &sourceFiles);
+};
+
+#endif /* !LEVELPACK_HPP_ */
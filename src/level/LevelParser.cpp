@@ -0,0 +1,365 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelParser
+*/
+
+#include "LevelParser.hpp"
+#include <fstream>
+#include <charconv>
+#include <algorithm>
+
+static const int MAX_DEPTH = 64;
+
+LevelParser::LevelParser(std::string_view json)
+    : input(json)
+    , pos(0)
+    , errorOffset(0)
+    , depth(0)
+{
+}
+
+bool LevelParser::Fail(const std::string &message)
+{
+    if (errorMessage.empty()) {
+        errorOffset = pos;
+        errorMessage = message;
+    }
+    return false;
+}
+
+ParseError LevelParser::GetError() const
+{
+    ParseError error;
+    error.line = 1;
+    error.column = 1;
+    size_t end = std::min(errorOffset, input.size());
+    for (size_t i = 0; i < end; ++i) {
+        if (input[i] == '\n') {
+            error.line++;
+            error.column = 1;
+        } else {
+            error.column++;
+        }
+    }
+    error.message = errorMessage;
+    return error;
+}
+
+void LevelParser::SkipWhitespace()
+{
+    while (pos < input.size()) {
+        char c = input[pos];
+        if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+            return;
+        pos++;
+    }
+}
+
+bool LevelParser::Expect(char c)
+{
+    SkipWhitespace();
+    if (pos >= input.size() || input[pos] != c)
+        return Fail(std::string("expected '") + c + "'");
+    pos++;
+    return true;
+}
+
+static void AppendUtf8(std::string &out, unsigned int code)
+{
+    if (code < 0x80) {
+        out += static_cast<char>(code);
+    } else if (code < 0x800) {
+        out += static_cast<char>(0xC0 | (code >> 6));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+        out += static_cast<char>(0xE0 | (code >> 12));
+        out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (code & 0x3F));
+    }
+}
+
+bool LevelParser::ParseString(std::string_view &out, std::string &decoded, bool &usedDecoded)
+{
+    if (!Expect('"'))
+        return false;
+    size_t start = pos;
+    usedDecoded = false;
+    // Fast path: most strings have no escapes and are returned as a view
+    while (pos < input.size()) {
+        char c = input[pos];
+        if (c == '"') {
+            out = input.substr(start, pos - start);
+            pos++;
+            return true;
+        }
+        if (c == '\\')
+            break;
+        if (static_cast<unsigned char>(c) < 0x20)
+            return Fail("control character in string");
+        pos++;
+    }
+    if (pos >= input.size())
+        return Fail("unterminated string");
+    decoded.assign(input.data() + start, pos - start);
+    usedDecoded = true;
+    while (pos < input.size()) {
+        char c = input[pos];
+        if (c == '"') {
+            pos++;
+            out = decoded;
+            return true;
+        }
+        if (static_cast<unsigned char>(c) < 0x20)
+            return Fail("control character in string");
+        if (c != '\\') {
+            decoded += c;
+            pos++;
+            continue;
+        }
+        if (++pos >= input.size())
+            return Fail("unterminated string");
+        char escape = input[pos++];
+        switch (escape) {
+            case '"': decoded += '"'; break;
+            case '\\': decoded += '\\'; break;
+            case '/': decoded += '/'; break;
+            case 'b': decoded += '\b'; break;
+            case 'f': decoded += '\f'; break;
+            case 'n': decoded += '\n'; break;
+            case 'r': decoded += '\r'; break;
+            case 't': decoded += '\t'; break;
+            case 'u': {
+                unsigned int code = 0;
+                if (pos + 4 > input.size())
+                    return Fail("truncated unicode escape");
+                auto result = std::from_chars(input.data() + pos, input.data() + pos + 4, code, 16);
+                if (result.ptr != input.data() + pos + 4)
+                    return Fail("invalid unicode escape");
+                pos += 4;
+                AppendUtf8(decoded, code);
+                break;
+            }
+            default:
+                pos--;
+                return Fail("invalid escape sequence");
+        }
+    }
+    return Fail("unterminated string");
+}
+
+bool LevelParser::ParseInt(int &out)
+{
+    SkipWhitespace();
+    const char *begin = input.data() + pos;
+    const char *end = input.data() + input.size();
+    auto result = std::from_chars(begin, end, out);
+    if (result.ec == std::errc::result_out_of_range)
+        return Fail("integer out of range");
+    if (result.ec != std::errc() || result.ptr == begin)
+        return Fail("expected integer");
+    pos += result.ptr - begin;
+    if (pos < input.size() && (input[pos] == '.' || input[pos] == 'e' || input[pos] == 'E'))
+        return Fail("expected integer");
+    return true;
+}
+
+bool LevelParser::ParsePosition(GridPos &out)
+{
+    if (!Expect('{'))
+        return false;
+    SkipWhitespace();
+    if (pos < input.size() && input[pos] == '}') {
+        pos++;
+        return true;
+    }
+    std::string decoded;
+    while (true) {
+        std::string_view key;
+        bool usedDecoded = false;
+        if (!ParseString(key, decoded, usedDecoded) || !Expect(':'))
+            return false;
+        if (key == "x") {
+            if (!ParseInt(out.x))
+                return false;
+        } else if (key == "y") {
+            if (!ParseInt(out.y))
+                return false;
+        } else if (!SkipValue()) {
+            return false;
+        }
+        SkipWhitespace();
+        if (pos < input.size() && input[pos] == ',') {
+            pos++;
+            continue;
+        }
+        return Expect('}');
+    }
+}
+
+bool LevelParser::ParseRows(LevelSource &out)
+{
+    if (!Expect('['))
+        return false;
+    out.rows.clear();
+    out.decodedRows.clear();
+    SkipWhitespace();
+    if (pos < input.size() && input[pos] == ']') {
+        pos++;
+        return true;
+    }
+    std::string decoded;
+    while (true) {
+        std::string_view row;
+        bool usedDecoded = false;
+        if (!ParseString(row, decoded, usedDecoded))
+            return false;
+        if (usedDecoded) {
+            out.decodedRows.push_back(decoded);
+            row = out.decodedRows.back();
+        }
+        out.rows.push_back(row);
+        SkipWhitespace();
+        if (pos < input.size() && input[pos] == ',') {
+            pos++;
+            continue;
+        }
+        return Expect(']');
+    }
+}
+
+bool LevelParser::SkipNumber()
+{
+    size_t start = pos;
+    if (pos < input.size() && input[pos] == '-')
+        pos++;
+    while (pos < input.size()) {
+        char c = input[pos];
+        if ((c < '0' || c > '9') && c != '.' && c != 'e' && c != 'E' && c != '+' && c != '-')
+            break;
+        pos++;
+    }
+    if (pos == start)
+        return Fail("unexpected character");
+    return true;
+}
+
+bool LevelParser::SkipLiteral(std::string_view literal)
+{
+    if (input.substr(pos, literal.size()) != literal)
+        return Fail("invalid literal");
+    pos += literal.size();
+    return true;
+}
+
+bool LevelParser::SkipValue()
+{
+    SkipWhitespace();
+    if (pos >= input.size())
+        return Fail("unexpected end of input");
+    if (++depth > MAX_DEPTH)
+        return Fail("nesting too deep");
+    bool ok = true;
+    std::string decoded;
+    std::string_view view;
+    bool usedDecoded = false;
+    char c = input[pos];
+    if (c == '"') {
+        ok = ParseString(view, decoded, usedDecoded);
+    } else if (c == '{' || c == '[') {
+        char close = (c == '{') ? '}' : ']';
+        pos++;
+        SkipWhitespace();
+        if (pos < input.size() && input[pos] == close) {
+            pos++;
+        } else {
+            while (ok) {
+                if (c == '{')
+                    ok = ParseString(view, decoded, usedDecoded) && Expect(':');
+                ok = ok && SkipValue();
+                if (!ok)
+                    break;
+                SkipWhitespace();
+                if (pos < input.size() && input[pos] == ',') {
+                    pos++;
+                    continue;
+                }
+                ok = Expect(close);
+                break;
+            }
+        }
+    } else if (c == 't') {
+        ok = SkipLiteral("true");
+    } else if (c == 'f') {
+        ok = SkipLiteral("false");
+    } else if (c == 'n') {
+        ok = SkipLiteral("null");
+    } else {
+        ok = SkipNumber();
+    }
+    depth--;
+    return ok;
+}
+
+bool LevelParser::Parse(LevelSource &out)
+{
+    pos = 0;
+    depth = 0;
+    errorMessage.clear();
+    if (!Expect('{'))
+        return false;
+    SkipWhitespace();
+    if (pos < input.size() && input[pos] == '}')
+        return Fail("empty level object");
+    std::string decoded;
+    while (true) {
+        std::string_view key;
+        bool usedDecoded = false;
+        if (!ParseString(key, decoded, usedDecoded) || !Expect(':'))
+            return false;
+        bool ok = true;
+        if (key == "name") {
+            std::string_view name;
+            ok = ParseString(name, decoded, usedDecoded);
+            out.name.assign(name.data(), name.size());
+        } else if (key == "width") {
+            ok = ParseInt(out.width);
+        } else if (key == "height") {
+            ok = ParseInt(out.height);
+        } else if (key == "playerStart") {
+            ok = ParsePosition(out.playerStart);
+        } else if (key == "grid") {
+            ok = ParseRows(out);
+        } else {
+            ok = SkipValue();
+        }
+        if (!ok)
+            return false;
+        SkipWhitespace();
+        if (pos < input.size() && input[pos] == ',') {
+            pos++;
+            continue;
+        }
+        if (!Expect('}'))
+            return false;
+        break;
+    }
+    SkipWhitespace();
+    if (pos != input.size())
+        return Fail("trailing characters after level object");
+    return true;
+}
+
+bool LevelParser::ReadFile(const std::string &filename, std::string &out)
+{
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+        return false;
+    std::streamsize size = file.tellg();
+    if (size < 0)
+        return false;
+    out.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    return static_cast<bool>(file.read(out.data(), size));
+}
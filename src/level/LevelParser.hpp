@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelParser
+*/
+
+#ifndef LEVELPARSER_HPP_
+#define LEVELPARSER_HPP_
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <deque>
+#include <cstddef>
+#include "GridPos.hpp"
+
+struct LevelSource {
+    std::string name;
+    int width = 0;
+    int height = 0;
+    GridPos playerStart = {0, 0};
+    std::vector<std::string_view> rows; // point into the input, or into decodedRows
+    std::deque<std::string> decodedRows; // only rows that contained escapes
+};
+
+struct ParseError {
+    size_t line = 0;
+    size_t column = 0;
+    std::string message;
+};
+
+class LevelParser {
+private:
+    std::string_view input;
+    size_t pos;
+    size_t errorOffset;
+    std::string errorMessage;
+    int depth;
+
+    bool Fail(const std::string &message);
+    void SkipWhitespace();
+    bool Expect(char c);
+    bool ParseString(std::string_view &out, std::string &decoded, bool &usedDecoded);
+    bool ParseInt(int &out);
+    bool ParsePosition(GridPos &out);
+    bool ParseRows(LevelSource &out);
+    bool SkipValue();
+    bool SkipNumber();
+    bool SkipLiteral(std::string_view literal);
+
+public:
+    explicit LevelParser(std::string_view json);
+    bool Parse(LevelSource &out);
+    ParseError GetError() const;
+
+    static bool ReadFile(const std::string &filename, std::string &out);
+};
+
+#endif /* !LEVELPARSER_HPP_ */
@@ -0,0 +1,216 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelValidator
+*/
+
+#include "LevelValidator.hpp"
+#include "LevelLoader.hpp"
+#include "LevelPack.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+std::unique_ptr<LevelReport[]> LevelValidator::reports;
+int LevelValidator::reportCount = 0;
+int LevelValidator::workerCount = 0;
+std::vector<std::thread> LevelValidator::workers;
+std::atomic<int> LevelValidator::nextLevel{0};
+std::atomic<int> LevelValidator::checkedCount{0};
+std::atomic<bool> LevelValidator::stopRequested{false};
+std::atomic<bool> LevelValidator::finished{false};
+std::vector<int> LevelValidator::invalidLevels;
+std::chrono::steady_clock::time_point LevelValidator::startTime;
+
+void LevelValidator::Start(int threadCount)
+{
+    Stop();
+    reportCount = LevelLoader::GetTotalLevels();
+    reports.reset(new LevelReport[reportCount]);
+    invalidLevels.clear();
+    nextLevel.store(0);
+    checkedCount.store(0);
+    stopRequested.store(false);
+    finished.store(reportCount == 0, std::memory_order_release);
+    if (reportCount == 0)
+        return;
+    if (threadCount <= 0)
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    threadCount = std::clamp(threadCount, 1, reportCount);
+    workerCount = threadCount;
+    startTime = std::chrono::steady_clock::now();
+    workers.reserve(threadCount);
+    for (int i = 0; i < threadCount; ++i)
+        workers.emplace_back(WorkerLoop);
+}
+
+void LevelValidator::Stop()
+{
+    stopRequested.store(true);
+    for (auto &worker : workers) {
+        if (worker.joinable())
+            worker.join();
+    }
+    workers.clear();
+}
+
+void LevelValidator::WorkerLoop()
+{
+    ValidatorScratch scratch;
+    while (!stopRequested.load(std::memory_order_relaxed)) {
+        int levelIndex = nextLevel.fetch_add(1, std::memory_order_relaxed);
+        if (levelIndex >= reportCount)
+            break;
+        ValidateLevel(levelIndex, scratch);
+        if (checkedCount.fetch_add(1, std::memory_order_acq_rel) + 1 == reportCount)
+            Finish();
+    }
+}
+
+void LevelValidator::ValidateLevel(int levelIndex, ValidatorScratch &scratch)
+{
+    LevelReport &report = reports[levelIndex];
+    auto begin = std::chrono::steady_clock::now();
+    Level level;
+    LevelStatus status;
+    if (LevelLoader::ReadLevel(level, levelIndex, scratch.buffer)) {
+        const LevelData &data = level.GetData();
+        report.name = data.name;
+        report.width = data.width;
+        report.height = data.height;
+        report.boxCount = level.GetBoxCount();
+        report.contentHash = LevelPack::HashLevel(level);
+        status = CheckLevel(level, report.detail, scratch);
+    } else {
+        status = LevelStatus::LOAD_ERROR;
+        report.detail = level.GetLoadError().empty() ? "could not read level" : level.GetLoadError();
+    }
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - begin;
+    report.loadMs = elapsed.count();
+    report.status.store(status, std::memory_order_release);
+}
+
+static std::string FormatCell(const char *what, GridPos pos, const char *problem)
+{
+    return std::string(what) + " at (" + std::to_string(pos.x) + ", " + std::to_string(pos.y) + ") " + problem;
+}
+
+LevelStatus LevelValidator::CheckLevel(const Level &level, std::string &detail, ValidatorScratch &scratch)
+{
+    const LevelData &data = level.GetData();
+    GridPos start = data.playerStart;
+    if (!level.IsValidPosition(start) || (level.GetCell(start.x, start.y) & (CELL_WALL | CELL_BOX))) {
+        detail = FormatCell("player start", start, "is outside the level or blocked");
+        return LevelStatus::NO_PLAYER;
+    }
+    int boxes = level.GetBoxCount();
+    int targets = static_cast<int>(level.GetTargetBits().Count());
+    if (boxes == 0 || boxes != targets) {
+        detail = std::to_string(boxes) + " box(es) for " + std::to_string(targets) + " target(s)";
+        return LevelStatus::BOX_TARGET_MISMATCH;
+    }
+    // Flood fill from the player through everything but walls: a box or target
+    // outside that region can never take part in the solution
+    const std::vector<uint8_t> &cells = level.GetCells();
+    scratch.visited.assign(cells.size(), 0);
+    scratch.stack.clear();
+    scratch.stack.push_back(level.Index(start));
+    scratch.visited[level.Index(start)] = 1;
+    while (!scratch.stack.empty()) {
+        size_t cell = scratch.stack.back();
+        scratch.stack.pop_back();
+        GridPos pos = {static_cast<int>(cell % data.width), static_cast<int>(cell / data.width)};
+        for (int d = 0; d < DIRECTION_COUNT; ++d) {
+            GridPos next = Step(pos, static_cast<Direction>(d));
+            if (!level.IsValidPosition(next))
+                continue;
+            size_t nextCell = level.Index(next);
+            if (scratch.visited[nextCell] || (cells[nextCell] & CELL_WALL))
+                continue;
+            scratch.visited[nextCell] = 1;
+            scratch.stack.push_back(nextCell);
+        }
+    }
+    for (int id = 0; id < boxes; ++id) {
+        GridPos pos = level.GetBoxPosition(id);
+        if (!scratch.visited[level.Index(pos)]) {
+            detail = FormatCell("box", pos, "cannot be reached by the player");
+            return LevelStatus::UNREACHABLE;
+        }
+    }
+    for (size_t i = 0; i < cells.size(); ++i) {
+        if ((cells[i] & CELL_TARGET) && !scratch.visited[i]) {
+            GridPos pos = {static_cast<int>(i % data.width), static_cast<int>(i / data.width)};
+            detail = FormatCell("target", pos, "cannot be reached by the player");
+            return LevelStatus::UNREACHABLE;
+        }
+    }
+    return LevelStatus::OK;
+}
+
+void LevelValidator::Finish()
+{
+    // Every worker published its report before bumping checkedCount, so the
+    // last one to finish sees all of them
+    std::chrono::duration<float, std::milli> elapsed = std::chrono::steady_clock::now() - startTime;
+    for (int i = 0; i < reportCount; ++i) {
+        if (reports[i].status.load(std::memory_order_acquire) != LevelStatus::OK)
+            invalidLevels.push_back(i);
+    }
+    // The full table is one line per level, so it is only printed on request
+    PrintReport(std::cout, std::getenv("SOKOBAN_LEVEL_REPORT") == nullptr);
+    std::cout << "Validated " << reportCount << " level(s) in " << std::fixed << std::setprecision(1)
+              << elapsed.count() << " ms on " << workerCount << " thread(s): "
+              << invalidLevels.size() << " problem(s)" << std::defaultfloat << std::endl;
+    finished.store(true, std::memory_order_release);
+}
+
+LevelStatus LevelValidator::GetStatus(int levelIndex)
+{
+    if (levelIndex < 0 || levelIndex >= reportCount)
+        return LevelStatus::PENDING;
+    return reports[levelIndex].status.load(std::memory_order_acquire);
+}
+
+const LevelReport *LevelValidator::GetReport(int levelIndex)
+{
+    if (GetStatus(levelIndex) == LevelStatus::PENDING)
+        return nullptr;
+    return &reports[levelIndex];
+}
+
+const char *LevelValidator::GetStatusName(LevelStatus status)
+{
+    switch (status) {
+        case LevelStatus::PENDING: return "pending";
+        case LevelStatus::OK: return "ok";
+        case LevelStatus::LOAD_ERROR: return "load error";
+        case LevelStatus::NO_PLAYER: return "no player";
+        case LevelStatus::BOX_TARGET_MISMATCH: return "box/target mismatch";
+        case LevelStatus::UNREACHABLE: return "unreachable";
+    }
+    return "unknown";
+}
+
+void LevelValidator::PrintReport(std::ostream &out, bool problemsOnly)
+{
+    if (problemsOnly && invalidLevels.empty())
+        return;
+    out << std::left << std::setw(7) << "#" << std::setw(21) << "status" << std::right << std::setw(9)
+        << "ms" << "  level\n";
+    int rowCount = problemsOnly ? static_cast<int>(invalidLevels.size()) : reportCount;
+    for (int row = 0; row < rowCount; ++row) {
+        int i = problemsOnly ? invalidLevels[row] : row;
+        const LevelReport &report = reports[i];
+        LevelStatus status = report.status.load(std::memory_order_acquire);
+        out << std::left << std::setw(7) << i << std::setw(21) << GetStatusName(status) << std::right
+            << std::setw(9) << std::fixed << std::setprecision(2) << report.loadMs << "  "
+            << LevelLoader::GetLevelFileName(i);
+        if (status != LevelStatus::OK && status != LevelStatus::PENDING)
+            out << " - " << report.detail;
+        out << '\n';
+    }
+    out << std::defaultfloat << std::flush;
+}
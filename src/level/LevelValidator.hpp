@@ -0,0 +1,86 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelValidator
+*/
+
+#ifndef LEVELVALIDATOR_HPP_
+#define LEVELVALIDATOR_HPP_
+#pragma once
+
+#include "Level.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class LevelStatus : uint8_t {
+    PENDING,
+    OK,
+    LOAD_ERROR,
+    NO_PLAYER,
+    BOX_TARGET_MISMATCH,
+    UNREACHABLE
+};
+
+struct LevelReport {
+    std::atomic<LevelStatus> status{LevelStatus::PENDING};
+    float loadMs = 0.0f;
+    std::string detail;
+    // Filled in for every level that loaded, LevelIndex refreshes from these
+    std::string name;
+    int width = 0;
+    int height = 0;
+    int boxCount = 0;
+    uint64_t contentHash = 0;
+};
+
+struct ValidatorScratch {
+    std::string buffer;
+    std::vector<uint8_t> visited;
+    std::vector<size_t> stack;
+};
+
+// Validates every level known to LevelLoader on a pool of worker threads.
+// Reports are published through the atomic status, so the UI can poll them
+// while the scan is still running. The level list must not change between
+// Start() and Stop()
+class LevelValidator {
+private:
+    static std::unique_ptr<LevelReport[]> reports;
+    static int reportCount;
+    static int workerCount;
+    static std::vector<std::thread> workers;
+    static std::atomic<int> nextLevel;
+    static std::atomic<int> checkedCount;
+    static std::atomic<bool> stopRequested;
+    static std::atomic<bool> finished;
+    static std::vector<int> invalidLevels;
+    static std::chrono::steady_clock::time_point startTime;
+
+    static void WorkerLoop();
+    static void ValidateLevel(int levelIndex, ValidatorScratch &scratch);
+    static LevelStatus CheckLevel(const Level &level, std::string &detail, ValidatorScratch &scratch);
+    static void Finish();
+
+public:
+    static void Start(int threadCount = 0);
+    static void Stop();
+    static bool IsFinished() { return finished.load(std::memory_order_acquire); }
+    static int GetCheckedCount() { return checkedCount.load(std::memory_order_relaxed); }
+    static int GetLevelCount() { return reportCount; }
+    static LevelStatus GetStatus(int levelIndex);
+    static const LevelReport *GetReport(int levelIndex);
+    // Only meaningful once IsFinished() returns true
+    static const std::vector<int>& GetInvalidLevels() { return invalidLevels; }
+    static const char *GetStatusName(LevelStatus status);
+    // Writes the broken levels, or every level when problemsOnly is false
+    static void PrintReport(std::ostream &out, bool problemsOnly = false);
+};
+
+#endif /* !LEVELVALIDATOR_HPP_ */
@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** MoveJournal
+*/
+
+#include "MoveJournal.hpp"
+
+MoveJournal::MoveJournal()
+    : length(0)
+    , cursor(0)
+{
+}
+
+uint8_t MoveJournal::Encode(JournalStep step)
+{
+    return static_cast<uint8_t>((static_cast<uint8_t>(step.direction) & 0x3) | (step.pushed ? 0x4 : 0x0));
+}
+
+JournalStep MoveJournal::Decode(uint8_t code)
+{
+    return {static_cast<Direction>(code & 0x3), (code & 0x4) != 0};
+}
+
+uint8_t MoveJournal::Get(size_t index) const
+{
+    uint8_t byte = packed[index >> 1];
+    return (index & 1) ? (byte >> 4) : (byte & 0x0F);
+}
+
+void MoveJournal::Put(size_t index, uint8_t code)
+{
+    if ((index >> 1) >= packed.size())
+        packed.push_back(0);
+    uint8_t &byte = packed[index >> 1];
+    if (index & 1)
+        byte = static_cast<uint8_t>((byte & 0x0F) | (code << 4));
+    else
+        byte = static_cast<uint8_t>((byte & 0xF0) | code);
+}
+
+void MoveJournal::Clear()
+{
+    packed.clear();
+    length = 0;
+    cursor = 0;
+}
+
+void MoveJournal::Record(Direction direction, bool pushed)
+{
+    if (direction == Direction::NONE)
+        return;
+    uint8_t code = Encode({direction, pushed});
+    // Replaying the move that is next in the redo tail keeps the tail
+    if (cursor < length && Get(cursor) == code) {
+        cursor++;
+        return;
+    }
+    length = cursor;
+    packed.resize((length + 1) >> 1);
+    Put(cursor, code);
+    cursor++;
+    length = cursor;
+}
+
+JournalStep MoveJournal::Undo()
+{
+    if (!CanUndo())
+        return {Direction::NONE, false};
+    cursor--;
+    return Decode(Get(cursor));
+}
+
+JournalStep MoveJournal::Redo()
+{
+    if (!CanRedo())
+        return {Direction::NONE, false};
+    JournalStep step = Decode(Get(cursor));
+    cursor++;
+    return step;
+}
@@ -0,0 +1,48 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** MoveJournal
+*/
+
+#ifndef MOVEJOURNAL_HPP_
+#define MOVEJOURNAL_HPP_
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "GridPos.hpp"
+
+struct JournalStep {
+    Direction direction;
+    bool pushed;
+};
+
+// Each step takes one nibble (2 bits of direction, 1 push bit), so two
+// steps share a byte and 20000 moves fit in 10 KB
+class MoveJournal {
+private:
+    std::vector<uint8_t> packed;
+    size_t length;
+    size_t cursor;
+    static uint8_t Encode(JournalStep step);
+    static JournalStep Decode(uint8_t code);
+    uint8_t Get(size_t index) const;
+    void Put(size_t index, uint8_t code);
+
+public:
+    MoveJournal();
+
+    void Clear();
+    void Record(Direction direction, bool pushed);
+    JournalStep Undo();
+    JournalStep Redo();
+    bool CanUndo() const { return cursor > 0; }
+    bool CanRedo() const { return cursor < length; }
+    size_t GetCursor() const { return cursor; }
+    size_t GetLength() const { return length; }
+    size_t GetMemoryUsage() const { return packed.capacity(); }
+};
+
+#endif /* !MOVEJOURNAL_HPP_ */
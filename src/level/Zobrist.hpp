@@ -0,0 +1,35 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** Zobrist
+*/
+
+#ifndef ZOBRIST_HPP_
+#define ZOBRIST_HPP_
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Keys are derived from the cell index with splitmix64 instead of being
+// stored in a table, so huge levels pay nothing in memory for hashing
+class Zobrist {
+private:
+    static constexpr uint64_t BOX_SEED = 0x9E3779B97F4A7C15ULL;
+    static constexpr uint64_t PLAYER_SEED = 0xD1B54A32D192ED03ULL;
+
+    static constexpr uint64_t Mix(uint64_t value)
+    {
+        value += 0x9E3779B97F4A7C15ULL;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        return value ^ (value >> 31);
+    }
+
+public:
+    static constexpr uint64_t BoxKey(size_t cell) { return Mix(BOX_SEED ^ cell); }
+    static constexpr uint64_t PlayerKey(size_t cell) { return Mix(PLAYER_SEED ^ cell); }
+};
+
+#endif /* !ZOBRIST_HPP_ */
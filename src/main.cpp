@@ -27,6 +27,7 @@ void SetupGameConfig(GameConfig& config)
     config.showGrid = false;
     config.inputDelay = 0.15f;
     config.allowDiagonalMovement = false;
+    config.powerMode = PowerMode::PERFORMANCE;
 }
 void ProcessCommandLineArgs(int argc, char* argv[], GameConfig& config)
 {
@@ -53,6 +54,10 @@ void ProcessCommandLineArgs(int argc, char* argv[], GameConfig& config)
             config.enableAnimations = false;
             std::cout << "Animations disabled" << std::endl;
         }
+        else if (arg == "--power-saver") {
+            config.powerMode = PowerMode::POWER_SAVER;
+            std::cout << "Power saver mode enabled" << std::endl;
+        }
         else if (arg == "--help" || arg == "-h") {
             std::cout << "Sokoban 3D - Usage:" << std::endl;
             std::cout << "  --fullscreen, -f     Enable fullscreen mode" << std::endl;
@@ -61,6 +66,7 @@ void ProcessCommandLineArgs(int argc, char* argv[], GameConfig& config)
             std::cout << "  --show-fps           Show FPS counter" << std::endl;
             std::cout << "  --no-animations      Disable animations" << std::endl;
             std::cout << "  --show-grid          Show debug grid" << std::endl;
+            std::cout << "  --power-saver        Only redraw when something changes" << std::endl;
             std::cout << "  --help, -h           Show this help message" << std::endl;
             exit(0);
         }
@@ -6,8 +6,12 @@
 */
 
 #include "GameScreen.hpp"
+#include "../level/LevelLoader.hpp"
+#include "../level/LevelValidator.hpp"
+#include "../level/LevelIndex.hpp"
+#include "../core/CookedAssets.hpp"
 #include <iostream>
-#include <filesystem>
+#include <algorithm>
 
 GameScreen::GameScreen() :
     state(GameScreenState::LOADING),
@@ -20,9 +24,16 @@ GameScreen::GameScreen() :
     fontLoaded(false),
     inputCooldown(0.0f),
     totalLevels(0),
-    soundsLoaded(false),
+    moveSoundLoaded(false),
+    pushSoundLoaded(false),
+    completeSoundLoaded(false),
     movementCooldown(0.0f),
-    generalInputCooldown(0.0f)
+    generalInputCooldown(0.0f),
+    historyCooldown(0.0f),
+    needsRedraw(true),
+    frozenByPause(false),
+    newBestScore(false),
+    usingLevelPack(false)
 {
     level = std::make_unique<Level>();
     player = std::make_unique<Player>();
@@ -39,6 +50,7 @@ bool GameScreen::Initialize()
         std::cerr << "Failed to initialize renderer!" << std::endl;
         return false;
     }
+    backdrop.Initialize();
     if (FileExists("assets/fonts/ui_font.ttf")) {
         uiFont = LoadFont("assets/fonts/ui_font.ttf");
         fontLoaded = true;
@@ -55,16 +67,9 @@ bool GameScreen::Initialize()
 
 void GameScreen::LoadSounds()
 {
-    if (FileExists("assets/sounds/move.wav")) {
-        moveSound = LoadSound("assets/sounds/move.wav");
-        soundsLoaded = true;
-    }
-    if (FileExists("assets/sounds/push.wav")) {
-        pushSound = LoadSound("assets/sounds/push.wav");
-    }
-    if (FileExists("assets/sounds/complete.wav")) {
-        completeSound = LoadSound("assets/sounds/complete.wav");
-    }
+    moveSound = CookedAssets::LoadSoundAsset("move", moveSoundLoaded);
+    pushSound = CookedAssets::LoadSoundAsset("push", pushSoundLoaded);
+    completeSound = CookedAssets::LoadSoundAsset("complete", completeSoundLoaded);
 }
 
 void GameScreen::Shutdown()
@@ -73,12 +78,23 @@ void GameScreen::Shutdown()
         UnloadFont(uiFont);
         fontLoaded = false;
     }
-    if (soundsLoaded) {
+    if (moveSoundLoaded) {
         UnloadSound(moveSound);
+        moveSoundLoaded = false;
+    }
+    if (pushSoundLoaded) {
         UnloadSound(pushSound);
+        pushSoundLoaded = false;
+    }
+    if (completeSoundLoaded) {
         UnloadSound(completeSound);
-        soundsLoaded = false;
+        completeSoundLoaded = false;
     }
+    watcher.Stop();
+    LevelValidator::Stop();
+    LevelIndex::Flush();
+    preloader.Cancel();
+    backdrop.Shutdown();
     if (renderer) {
         renderer->Shutdown();
     }
@@ -87,25 +103,60 @@ void GameScreen::Shutdown()
 
 void GameScreen::InitializeLevelFiles()
 {
-    levelFiles.clear();
-    for (int i = 1; i <= 10; i++) {
-        std::string filename = "assets/levels/level" + std::to_string(i) + ".json";
-        levelFiles.push_back(filename);
-    }
-    totalLevels = static_cast<int>(levelFiles.size());
+    watcher.Stop();
+    LevelValidator::Stop();
+    usingLevelPack = CookedAssets::Exists(CookedAssets::LEVEL_PACK) &&
+                     LevelLoader::LoadLevelPack(CookedAssets::GetPath(CookedAssets::LEVEL_PACK));
+    if (!usingLevelPack)
+        LevelLoader::LoadLevelList("assets/levels/");
+    // The pack is cooked from assets/levels, so edits there matter either way
+    watcher.Start("assets/levels/");
+    StartLevelChecks();
+}
+
+void GameScreen::StartLevelChecks()
+{
+    totalLevels = std::max(1, LevelLoader::GetTotalLevels());
     std::cout << "Found " << totalLevels << " levels" << std::endl;
+    LevelIndex::Load();
+    LevelValidator::Start();
+}
+
+void GameScreen::SwitchToLevelFiles()
+{
+    // A level file changed after the pack was cooked, so the pack is stale
+    // for the rest of the session; keep playing the same level from its file
+    std::string source = LevelLoader::GetLevelSource(currentLevel);
+    preloader.Cancel();
+    LevelValidator::Stop();
+    LevelIndex::Flush();
+    usingLevelPack = false;
+    std::cout << "Level files changed, switching from the level pack to assets/levels/" << std::endl;
+    LevelLoader::LoadLevelList("assets/levels/");
+    StartLevelChecks();
+    int levelIndex = LevelLoader::FindLevel(source);
+    currentLevel = (levelIndex >= 0) ? levelIndex : std::min(currentLevel, totalLevels - 1);
+    LevelLoader::SetCurrentLevel(currentLevel);
+    if (currentLevel + 1 < totalLevels)
+        preloader.Request(currentLevel + 1);
 }
 
 void GameScreen::Update(float deltaTime)
 {
+    GameScreenState previousState = state;
+    int previousMoves = moveCount;
+    int previousSeconds = static_cast<int>(gameTime);
     if (movementCooldown > 0)
         movementCooldown -= deltaTime;
     if (generalInputCooldown > 0)
         generalInputCooldown -= deltaTime;
+    if (historyCooldown > 0)
+        historyCooldown -= deltaTime;
     if (state == GameScreenState::PLAYING)
         gameTime += deltaTime;
     if (state == GameScreenState::LEVEL_COMPLETE)
         levelCompleteTimer += deltaTime;
+    ApplyHotReloads();
     ProcessInput();
     UpdateGameLogic(deltaTime);
     if (player)
@@ -116,6 +167,16 @@ void GameScreen::Update(float deltaTime)
     }
     if (state == GameScreenState::PLAYING)
         CheckLevelCompletion();
+    if (state != previousState || moveCount != previousMoves || static_cast<int>(gameTime) != previousSeconds)
+        needsRedraw = true;
+    if (player && player->IsMoving())
+        needsRedraw = true;
+    for (const auto& box : boxes) {
+        if (box && box->HasActiveEffects()) {
+            needsRedraw = true;
+            break;
+        }
+    }
 }
 
 void GameScreen::ProcessInput()
@@ -149,33 +210,52 @@ void GameScreen::ProcessInput()
         }
         return;
     }
-    if (state == GameScreenState::PLAYING)
+    if (state == GameScreenState::PLAYING) {
+        HandleHistoryInput();
         HandlePlayerMovement();
+    }
+}
+
+void GameScreen::HandleHistoryInput()
+{
+    bool undoPressed = IsKeyPressed(KEY_Z) || IsKeyPressed(KEY_BACKSPACE);
+    bool redoPressed = IsKeyPressed(KEY_Y);
+    bool undoHeld = IsKeyDown(KEY_Z) || IsKeyDown(KEY_BACKSPACE);
+    bool redoHeld = IsKeyDown(KEY_Y);
+    if (undoPressed || redoPressed) {
+        // A fresh press acts at once, then holding waits before repeating
+        if (undoPressed)
+            UndoMove();
+        else
+            RedoMove();
+        historyCooldown = 0.35f;
+        movementCooldown = 0.12f;
+        return;
+    }
+    if (historyCooldown > 0 || (!undoHeld && !redoHeld))
+        return;
+    if (undoHeld)
+        UndoMove();
+    else
+        RedoMove();
+    historyCooldown = 0.05f;
+    movementCooldown = 0.12f;
 }
 
 void GameScreen::HandlePlayerMovement()
 {
     if (movementCooldown > 0)
         return;
-    Vector2 direction = {0, 0};
-    bool moveRequested = false;
-    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W)) {
-        direction = {0, -1};
-        moveRequested = true;
-    }
-    else if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S)) {
-        direction = {0, 1};
-        moveRequested = true;
-    }
-    else if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A)) {
-        direction = {-1, 0};
-        moveRequested = true;
-    }
-    else if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D)) {
-        direction = {1, 0};
-        moveRequested = true;
-    }
-    if (moveRequested) {
+    Direction direction = Direction::NONE;
+    if (IsKeyDown(KEY_UP) || IsKeyDown(KEY_W))
+        direction = Direction::UP;
+    else if (IsKeyDown(KEY_DOWN) || IsKeyDown(KEY_S))
+        direction = Direction::DOWN;
+    else if (IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_A))
+        direction = Direction::LEFT;
+    else if (IsKeyDown(KEY_RIGHT) || IsKeyDown(KEY_D))
+        direction = Direction::RIGHT;
+    if (direction != Direction::NONE) {
         bool success = TryMovePlayer(direction);
         if (success) {
             movementCooldown = 0.12f;
@@ -189,76 +269,82 @@ void GameScreen::SynchronizeBoxesWithLevel()
 {
     if (!level)
         return;
-    int width = level->GetWidth();
-    int height = level->GetHeight();
-    std::vector<Vector2> boxPositions;
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            if (level->HasBox(x, y)) {
-                boxPositions.push_back({static_cast<float>(x), static_cast<float>(y)});
-            }
-        }
-    }
-    size_t numBoxesToUpdate = std::min(boxes.size(), boxPositions.size());
-    for (size_t i = 0; i < numBoxesToUpdate; i++) {
-        if (boxes[i]) {
-            Vector3 worldPos = level->GridToWorld(
-                static_cast<int>(boxPositions[i].x),
-                static_cast<int>(boxPositions[i].y)
-            );
-            boxes[i]->SetPosition(worldPos);
-        }
-    }
-    if (boxPositions.size() > boxes.size()) {
-        for (size_t i = boxes.size(); i < boxPositions.size(); i++) {
-            Vector3 worldPos = level->GridToWorld(
-                static_cast<int>(boxPositions[i].x),
-                static_cast<int>(boxPositions[i].y)
-            );
-            auto newBox = std::make_unique<Box>();
-            newBox->SetPosition(worldPos);
-            boxes.push_back(std::move(newBox));
-        }
-    }
-    if (boxPositions.size() < boxes.size())
-        boxes.resize(boxPositions.size());
+    for (int boxId = 0; boxId < static_cast<int>(boxes.size()); boxId++)
+        SyncBox(boxId);
+}
+
+void GameScreen::SyncBox(int boxId)
+{
+    if (!level || boxId < 0 || boxId >= static_cast<int>(boxes.size()) || !boxes[boxId])
+        return;
+    GridPos gridPos = level->GetBoxPosition(boxId);
+    boxes[boxId]->SyncWithLevel(gridPos, level->GridToWorld(gridPos));
 }
 
-bool GameScreen::TryMovePlayer(Vector2 direction)
+bool GameScreen::TryMovePlayer(Direction direction)
 {
-    if (!level || !player)
+    bool pushed = false;
+    if (!ApplyMove(direction, pushed))
         return false;
-    Vector2 playerPos = player->GetGridPosition();
-    Vector2 newPos = {playerPos.x + direction.x, playerPos.y + direction.y};
-    if (!level->IsValidPosition(static_cast<int>(newPos.x), static_cast<int>(newPos.y)))
+    journal.Record(direction, pushed);
+    return true;
+}
+
+bool GameScreen::ApplyMove(Direction direction, bool &pushed)
+{
+    pushed = false;
+    if (!level || !player || direction == Direction::NONE)
         return false;
-    TileType tileType = level->GetTileType(static_cast<int>(newPos.x), static_cast<int>(newPos.y));
+    GridPos newPos = Step(player->GetGridPosition(), direction);
+    if (!level->IsValidPosition(newPos))
+        return false;
+    TileType tileType = level->GetTileType(newPos.x, newPos.y);
     if (tileType == TileType::WALL)
         return false;
-    if (level->HasBox(static_cast<int>(newPos.x), static_cast<int>(newPos.y))) {
-        Vector2 boxNewPos = {newPos.x + direction.x, newPos.y + direction.y};
-        if (!level->IsValidPosition(static_cast<int>(boxNewPos.x), static_cast<int>(boxNewPos.y))) {
-            return false;
-        }
-        if (!level->CanMoveToTile(static_cast<int>(boxNewPos.x), static_cast<int>(boxNewPos.y))) {
+    if (level->HasBox(newPos)) {
+        GridPos boxNewPos = Step(newPos, direction);
+        if (!level->CanMoveToTile(boxNewPos)) {
             return false;
         }
-        level->MoveBox(
-            static_cast<int>(newPos.x), static_cast<int>(newPos.y),
-            static_cast<int>(boxNewPos.x), static_cast<int>(boxNewPos.y)
-        );
+        SyncBox(level->MoveBox(newPos, boxNewPos));
+        pushed = true;
         PlayPushSound();
     } else {
         PlayMoveSound();
     }
     player->SetGridPosition(newPos);
-    Vector3 worldPos = level->GridToWorld(static_cast<int>(newPos.x), static_cast<int>(newPos.y));
+    Vector3 worldPos = level->GridToWorld(newPos);
     player->SetPosition(worldPos);
-    SynchronizeBoxesWithLevel();
     IncrementMoveCount();
     return true;
 }
 
+bool GameScreen::UndoMove()
+{
+    if (!level || !player || !journal.CanUndo())
+        return false;
+    JournalStep step = journal.Undo();
+    GridPos playerPos = player->GetGridPosition();
+    GridPos offset = DirectionOffset(step.direction);
+    if (step.pushed)
+        SyncBox(level->MoveBox(playerPos + offset, playerPos));
+    GridPos previous = playerPos - offset;
+    player->SetGridPosition(previous);
+    player->SetPosition(level->GridToWorld(previous));
+    if (moveCount > 0)
+        moveCount--;
+    return true;
+}
+
+bool GameScreen::RedoMove()
+{
+    if (!journal.CanRedo())
+        return false;
+    bool pushed = false;
+    JournalStep step = journal.Redo();
+    return ApplyMove(step.direction, pushed);
+}
+
 void GameScreen::UpdateGameLogic(float deltaTime)
 {
     if (renderer && player) {
@@ -275,6 +361,7 @@ void GameScreen::CheckLevelCompletion()
     if (level && level->IsCompleted()) {
         state = GameScreenState::LEVEL_COMPLETE;
         levelCompleteTimer = 0.0f;
+        newBestScore = LevelIndex::RecordScore(currentLevel, moveCount, gameTime);
         PlayCompleteSound();
         std::cout << "Level completed!" << std::endl;
     }
@@ -284,53 +371,63 @@ void GameScreen::Draw()
 {
     if (!renderer)
         return;
+    // While an overlay is up the world cannot change, so it is rendered
+    // once into the backdrop and that texture is reused every frame
+    bool frozen = frozenByPause || state == GameScreenState::LEVEL_COMPLETE;
+    if (frozen && !backdrop.IsValid()) {
+        renderer->RefreshStaticLayer();
+        if (backdrop.BeginCapture()) {
+            DrawWorld();
+            backdrop.EndCapture(frozenByPause);
+        }
+    }
+    if (frozen && backdrop.IsValid()) {
+        backdrop.Draw();
+    } else {
+        backdrop.Invalidate();
+        DrawWorld();
+    }
+    if (state == GameScreenState::LEVEL_COMPLETE)
+        DrawLevelCompleteOverlay();
+    needsRedraw = false;
+}
+
+void GameScreen::SetFrozen(bool frozen)
+{
+    frozenByPause = frozen;
+    backdrop.Invalidate();
+    needsRedraw = true;
+}
+
+void GameScreen::DrawWorld()
+{
     renderer->BeginFrame();
-    BeginMode3D(renderer->GetCamera());
+    renderer->Begin3D();
     if (level) {
-        const LevelData& levelData = level->GetData();
-        for (int y = 0; y < levelData.height; y++) {
-            for (int x = 0; x < levelData.width; x++) {
-                Vector3 worldPos = level->GridToWorld(x, y);
-                TileType tileType = level->GetTileType(x, y);
-
-                switch (tileType) {
-                    case TileType::WALL:
-                        renderer->DrawWall(worldPos);
-                        break;
-                    case TileType::FLOOR:
-                    case TileType::PLAYER_START:
-                        renderer->DrawFloor(worldPos);
-                        if (level->IsTarget(x, y)) {
-                            renderer->DrawTarget(worldPos);
-                        }
-                        break;
-                    case TileType::TARGET:
-                        renderer->DrawFloor(worldPos);
-                        renderer->DrawTarget(worldPos);
-                        break;
-                }
-            }
-        }
+        renderer->ClearBoxInstances();
         for (const auto& box : boxes) {
             if (box) {
-                Vector3 boxPos = box->GetPosition();
-                Vector2 gridPos = box->GetGridPosition();
-                bool onTarget = level->IsTarget(static_cast<int>(gridPos.x), static_cast<int>(gridPos.y));
-                renderer->DrawBox(boxPos, onTarget);
+                bool onTarget = level->IsTarget(box->GetGridPosition());
+                box->SetLodLevel(renderer->AddBoxInstance(box->GetPosition(), onTarget, box->GetLodLevel()));
             }
         }
+        renderer->DrawLevel();
         if (player) {
             Vector3 playerPos = player->GetPosition();
             renderer->DrawPlayer(playerPos, player->GetRotation());
         }
+        for (const auto& box : boxes) {
+            if (!box)
+                continue;
+            if (level->IsTarget(box->GetGridPosition()))
+                renderer->DrawBoxEffects(box->GetPosition(), box->GetLodLevel());
+        }
     } else {
         std::cout << "No level loaded!" << std::endl;
         DrawCube({0, 1, 0}, 2, 2, 2, RED);
     }
-    EndMode3D();
+    renderer->End3D();
     DrawUI();
-    if (state == GameScreenState::LEVEL_COMPLETE)
-        DrawLevelCompleteOverlay();
     renderer->EndFrame();
 }
 
@@ -354,6 +451,13 @@ void GameScreen::DrawGameStats()
     std::string timeText = "Time: " + std::to_string(minutes) + ":" + 
                           (seconds < 10 ? "0" : "") + std::to_string(seconds);
     DrawTextEx(uiFont, timeText.c_str(), {20, static_cast<float>(y)}, fontSize, 1, WHITE);
+#ifdef DEBUG
+    y += 30;
+    std::string renderText = "Draws: " + std::to_string(renderer->GetDrawCallCount()) +
+                             "  Flushes: " + std::to_string(renderer->GetBatchFlushCount()) +
+                             " (unsorted " + std::to_string(renderer->GetUnsortedBatchFlushCount()) + ")";
+    DrawTextEx(uiFont, renderText.c_str(), {20, static_cast<float>(y)}, 16, 1, GRAY);
+#endif
 }
 
 void GameScreen::DrawInstructions()
@@ -361,7 +465,7 @@ void GameScreen::DrawInstructions()
     int fontSize = 16;
     int screenHeight = GetScreenHeight();
     int y = screenHeight - 80;
-    DrawTextEx(uiFont, "WASD/Arrows: Move  |  R: Restart  |  ESC: Pause  |  M: Menu",
+    DrawTextEx(uiFont, "WASD/Arrows: Move  |  Z/Y: Undo/Redo  |  R: Restart  |  ESC: Pause  |  M: Menu",
                {20, static_cast<float>(y)}, fontSize, 1, LIGHTGRAY);
 }
 
@@ -381,6 +485,11 @@ void GameScreen::DrawLevelCompleteOverlay()
     int statsSize = 24;
     int statsY = static_cast<int>(titlePos.y) + 80;
     std::string statsText = "Moves: " + std::to_string(moveCount);
+    const LevelMeta *meta = LevelIndex::GetEntry(currentLevel);
+    if (newBestScore)
+        statsText += "  (new best!)";
+    else if (meta && meta->bestMoves >= 0)
+        statsText += "  (best: " + std::to_string(meta->bestMoves) + ")";
     Vector2 statsTextSize = MeasureTextEx(uiFont, statsText.c_str(), statsSize, 1);
     Vector2 statsPos = {
         screenWidth / 2.0f - statsTextSize.x / 2.0f,
@@ -411,43 +520,99 @@ bool GameScreen::LoadLevel(int levelIndex)
     if (levelIndex < 0 || levelIndex >= totalLevels) {
         return false;
     }
+    needsRedraw = true;
     std::cout << "Loading level " << (levelIndex + 1) << "..." << std::endl;
     boxes.clear();
-    bool levelLoaded = false;
-    if (std::filesystem::exists(levelFiles[levelIndex])) {
-        levelLoaded = level->LoadFromFile(levelFiles[levelIndex]);
-        std::cout << "Attempted to load: " << levelFiles[levelIndex] << std::endl;
-    }
-    if (!levelLoaded) {
+    PreloadedLevel preloaded;
+    bool wasPreloaded = preloader.Take(levelIndex, preloaded);
+    if (wasPreloaded) {
+        level = std::move(preloaded.level);
+        LevelLoader::SetCurrentLevel(levelIndex);
+    } else if (!LevelLoader::LoadLevel(*level, levelIndex)) {
         std::cerr << "Could not load level, creating test level!" << std::endl;
         CreateTestLevel();
-        levelLoaded = true;
     }
     const LevelData& levelData = level->GetData();
-    Vector3 playerStartPos = level->GridToWorld(
-        static_cast<int>(levelData.playerStart.x),
-        static_cast<int>(levelData.playerStart.y)
-    );
+    Vector3 playerStartPos = level->GridToWorld(levelData.playerStart);
     player->Initialize(playerStartPos);
     player->SetGridPosition(levelData.playerStart);
     CreateBoxes();
     if (renderer) {
-        float centerX = levelData.width * 0.5f;
-        float centerZ = levelData.height * 0.5f;
-        Vector3 cameraPos = {centerX + 8.0f, 10.0f, centerZ + 8.0f};
-        Vector3 cameraTarget = {centerX, 0.0f, centerZ};
-        Vector3 cameraUp = {0.0f, 1.0f, 0.0f};
-        renderer->SetCamera(cameraPos, cameraTarget, cameraUp);
+        if (wasPreloaded)
+            renderer->AdoptLevelGeometry(std::move(preloaded.geometry));
+        else
+            renderer->BuildLevelGeometry(*level);
+        CenterCamera();
     }
     ResetStats();
+    journal.Clear();
     state = GameScreenState::PLAYING;
-    std::cout << "Level " << (levelIndex + 1) << " loaded successfully!" << std::endl;
+    preloader.Request(levelIndex + 1);
+    std::cout << "Level " << (levelIndex + 1) << (wasPreloaded ? " swapped in from preload" : " loaded successfully!")
+              << std::endl;
     std::cout << "Level size: " << levelData.width << "x" << levelData.height << std::endl;
     std::cout << "Player start: " << levelData.playerStart.x << "," << levelData.playerStart.y << std::endl;
     std::cout << "Total boxes: " << boxes.size() << std::endl;
     return true;
 }
 
+void GameScreen::CenterCamera()
+{
+    const LevelData& levelData = level->GetData();
+    float centerX = levelData.width * 0.5f;
+    float centerZ = levelData.height * 0.5f;
+    Vector3 cameraPos = {centerX + 8.0f, 10.0f, centerZ + 8.0f};
+    Vector3 cameraTarget = {centerX, 0.0f, centerZ};
+    Vector3 cameraUp = {0.0f, 1.0f, 0.0f};
+    renderer->SetCamera(cameraPos, cameraTarget, cameraUp);
+}
+
+void GameScreen::ApplyHotReloads()
+{
+    LevelReload reload;
+    while (watcher.Poll(reload)) {
+        if (usingLevelPack)
+            SwitchToLevelFiles();
+        int levelIndex = LevelLoader::FindLevelFile(reload.path);
+        if (levelIndex < 0) {
+            std::cout << "Ignoring change to " << reload.path << ", new level files are picked up on restart"
+                      << std::endl;
+            continue;
+        }
+        LevelIndex::UpdateLevel(levelIndex, *reload.level);
+        if (levelIndex == preloader.GetPendingIndex()) {
+            preloader.Cancel();
+            preloader.Request(levelIndex);
+        }
+        if (levelIndex == currentLevel && state != GameScreenState::LOADING)
+            ApplyHotReload(std::move(reload.level));
+    }
+}
+
+void GameScreen::ApplyHotReload(std::unique_ptr<Level> reloaded)
+{
+    // Boxes come back to the edited layout, the player stays put if the new
+    // layout still has room there
+    GridPos playerPos = player->GetGridPosition();
+    if (!reloaded->CanMoveToTile(playerPos))
+        playerPos = reloaded->GetData().playerStart;
+    bool resized = reloaded->GetWidth() != level->GetWidth() || reloaded->GetHeight() != level->GetHeight();
+    int rebuiltChunks = renderer ? renderer->UpdateLevelGeometry(*level, *reloaded) : 0;
+    boxes.clear();
+    level = std::move(reloaded);
+    player->StopMovement();
+    player->SetGridPosition(playerPos);
+    CreateBoxes();
+    if (renderer && resized)
+        CenterCamera();
+    ResetStats();
+    journal.Clear();
+    state = GameScreenState::PLAYING;
+    needsRedraw = true;
+    std::cout << "Hot reloaded level " << (currentLevel + 1) << ", " << rebuiltChunks
+              << " chunk(s) rebuilt" << std::endl;
+}
+
 void GameScreen::CreateBoxes()
 {
     boxes.clear();
@@ -455,16 +620,12 @@ void GameScreen::CreateBoxes()
         std::cout << "No level available for creating boxes!" << std::endl;
         return;
     }
-    const LevelData& levelData = level->GetData();
-    for (int y = 0; y < levelData.height; y++) {
-        for (int x = 0; x < levelData.width; x++) {
-            if (level->HasBox(x, y)) {
-                auto box = std::make_unique<Box>();
-                Vector2 gridPos = {static_cast<float>(x), static_cast<float>(y)};
-                box->Initialize(gridPos, level.get());
-                boxes.push_back(std::move(box));
-            }
-        }
+    // boxes[i] always mirrors the level's box id i, so entities keep their
+    // identity (and running animations) across pushes
+    for (int boxId = 0; boxId < level->GetBoxCount(); boxId++) {
+        auto box = std::make_unique<Box>();
+        box->Initialize(level->GetBoxPosition(boxId), level.get());
+        boxes.push_back(std::move(box));
     }
 }
 
@@ -498,7 +659,22 @@ bool GameScreen::LoadNextLevel()
 
 void GameScreen::RestartLevel()
 {
-    LoadLevel(currentLevel);
+    if (state == GameScreenState::LOADING || !level || !player) {
+        LoadLevel(currentLevel);
+        return;
+    }
+    level->Reset();
+    GridPos start = level->GetData().playerStart;
+    player->StopMovement();
+    player->SetGridPosition(start);
+    if (static_cast<int>(boxes.size()) == level->GetBoxCount())
+        SynchronizeBoxesWithLevel();
+    else
+        CreateBoxes();
+    ResetStats();
+    journal.Clear();
+    state = GameScreenState::PLAYING;
+    needsRedraw = true;
 }
 
 bool GameScreen::IsLevelComplete() const
@@ -521,21 +697,21 @@ void GameScreen::ClearFlags()
 
 void GameScreen::PlayMoveSound()
 {
-    if (soundsLoaded) {
+    if (moveSoundLoaded) {
         PlaySound(moveSound);
     }
 }
 
 void GameScreen::PlayPushSound()
 {
-    if (soundsLoaded) {
+    if (pushSoundLoaded) {
         PlaySound(pushSound);
     }
 }
 
 void GameScreen::PlayCompleteSound()
 {
-    if (soundsLoaded) {
+    if (completeSoundLoaded) {
         PlaySound(completeSound);
     }
 }
\ No newline at end of file
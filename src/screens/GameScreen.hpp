@@ -12,9 +12,13 @@
 #include <raylib.h>
 #include <memory>
 #include "../level/Level.hpp"
+#include "../level/MoveJournal.hpp"
 #include "../entities/Player.hpp"
 #include "../entities/Box.hpp"
 #include "../graphics/Renderer.hpp"
+#include "../graphics/FrameBackdrop.hpp"
+#include "../core/LevelPreloader.hpp"
+#include "../core/LevelWatcher.hpp"
 
 enum class GameScreenState {
     LOADING,
@@ -43,27 +47,47 @@ private:
     bool fontLoaded;
     float inputCooldown;
     const float INPUT_DELAY = 0.15f;
-    std::vector<std::string> levelFiles;
     int totalLevels;
     Sound moveSound;
     Sound pushSound;
     Sound completeSound;
-    bool soundsLoaded;
+    bool moveSoundLoaded;
+    bool pushSoundLoaded;
+    bool completeSoundLoaded;
     float movementCooldown;
     float generalInputCooldown;
+    float historyCooldown;
+    MoveJournal journal;
+    bool needsRedraw;
+    bool frozenByPause;
+    bool newBestScore;
+    FrameBackdrop backdrop;
+    LevelPreloader preloader;
+    LevelWatcher watcher;
+    bool usingLevelPack;
     void InitializeLevelFiles();
+    void StartLevelChecks();
+    void SwitchToLevelFiles();
     void LoadSounds();
     bool LoadLevel(int levelIndex);
     void CreateBoxes();
+    void CenterCamera();
+    void ApplyHotReloads();
+    void ApplyHotReload(std::unique_ptr<Level> reloaded);
     void ProcessInput();
     void UpdateGameLogic(float deltaTime);
     void CheckLevelCompletion();
     void HandlePlayerMovement();
-    bool TryMovePlayer(Vector2 direction);
-    bool TryPushBox(int boxIndex, Vector2 direction);
+    bool TryMovePlayer(Direction direction);
+    bool ApplyMove(Direction direction, bool &pushed);
+    void HandleHistoryInput();
+    bool UndoMove();
+    bool RedoMove();
+    bool TryPushBox(int boxIndex, Direction direction);
     void PlayMoveSound();
     void PlayPushSound();
     void PlayCompleteSound();
+    void DrawWorld();
     void DrawUI();
     void DrawLevelCompleteOverlay();
     void DrawGameStats();
@@ -84,12 +108,15 @@ public:
     bool IsLevelComplete() const;
     bool ShouldShowPause() const { return shouldShowPause; }
     bool ShouldReturnToMenu() const { return shouldReturnToMenu; }
+    bool NeedsRedraw() const { return needsRedraw; }
+    void SetFrozen(bool frozen);
     void IncrementMoveCount() { moveCount++; }
     int GetMoveCount() const { return moveCount; }
     float GetGameTime() const { return gameTime; }
     void ResetStats();
     void CreateTestLevel();
     void SynchronizeBoxesWithLevel();
+    void SyncBox(int boxId);
     void ClearFlags();
 };
 
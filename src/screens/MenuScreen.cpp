@@ -6,6 +6,11 @@
 */
 
 #include "MenuScreen.hpp"
+#include "../core/CookedAssets.hpp"
+#include "../level/LevelLoader.hpp"
+#include "../level/LevelValidator.hpp"
+#include "../level/LevelIndex.hpp"
+#include <algorithm>
 #include <cmath>
 
 MenuScreen::MenuScreen() :
@@ -20,7 +25,12 @@ MenuScreen::MenuScreen() :
     selectedColor({255, 100, 100, 255}),
     normalColor({200, 200, 200, 255}),
     menuSpacing(60.0f),
-    inputCooldown(0.0f)
+    inputCooldown(0.0f),
+    needsRedraw(true),
+    validatedLevels(-1),
+    levelSelectOpen(false),
+    levelSelection(0),
+    chosenLevel(-1)
 {
     InitializeMenuItems();
 }
@@ -48,8 +58,10 @@ bool MenuScreen::Initialize()
         font = GetFontDefault();
         fontLoaded = false;
     }
-    if (FileExists("assets/sounds/menu_music.mp3")) {
-        backgroundMusic = LoadMusicStream("assets/sounds/menu_music.mp3");
+    std::string musicPath = CookedAssets::Exists("menu_music.wav") ?
+        CookedAssets::GetPath("menu_music.wav") : "assets/sounds/menu_music.mp3";
+    if (FileExists(musicPath.c_str())) {
+        backgroundMusic = LoadMusicStream(musicPath.c_str());
         musicLoaded = true;
         SetMusicVolume(backgroundMusic, 0.3f);
     }
@@ -86,8 +98,17 @@ void MenuScreen::Update(float deltaTime)
     if (inputCooldown > 0)
         inputCooldown -= deltaTime;
     UpdateAnimations(deltaTime);
+    int checked = LevelValidator::IsFinished() ? LevelValidator::GetLevelCount() + 1 : LevelValidator::GetCheckedCount();
+    if (checked != validatedLevels) {
+        validatedLevels = checked;
+        needsRedraw = true;
+    }
     if (musicLoaded && IsMusicStreamPlaying(backgroundMusic))
         UpdateMusicStream(backgroundMusic);
+    if (levelSelectOpen) {
+        UpdateLevelSelect();
+        return;
+    }
     if (inputCooldown <= 0) {
         if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_W)) {
             MoveUp();
@@ -117,8 +138,13 @@ void MenuScreen::Draw()
 {
     DrawBackground();
     DrawTitle();
-    DrawMenuItems();
+    if (levelSelectOpen)
+        DrawLevelSelect();
+    else
+        DrawMenuItems();
     DrawFooter();
+    DrawLevelStatus();
+    needsRedraw = false;
 }
 
 void MenuScreen::DrawBackground()
@@ -183,7 +209,9 @@ void MenuScreen::DrawMenuItems()
 
 void MenuScreen::DrawFooter()
 {
-    const char* instructions = "Use ARROW KEYS or WASD to navigate, ENTER to select, ESC to quit";
+    const char* instructions = levelSelectOpen ?
+        "UP/DOWN to choose, PAGE UP/DOWN to skip, ENTER to play, BACKSPACE to go back" :
+        "Use ARROW KEYS or WASD to navigate, ENTER to select, ESC to quit";
     int fontSize = 20;
     Vector2 textSize = MeasureTextEx(font, instructions, fontSize, 1);
     Vector2 footerPos = {
@@ -193,7 +221,120 @@ void MenuScreen::DrawFooter()
     DrawTextEx(font, instructions, footerPos, fontSize, 1, {150, 150, 150, 255});
 }
 
+void MenuScreen::DrawLevelStatus()
+{
+    const int fontSize = 18;
+    const int maxListed = 5;
+    Vector2 pos = {20.0f, 40.0f};
+    int total = LevelValidator::GetLevelCount();
+    if (!LevelValidator::IsFinished()) {
+        const char *text = TextFormat("Checking levels... %d/%d", LevelValidator::GetCheckedCount(), total);
+        DrawTextEx(font, text, pos, fontSize, 1, normalColor);
+        return;
+    }
+    const std::vector<int> &invalid = LevelValidator::GetInvalidLevels();
+    if (invalid.empty()) {
+        DrawTextEx(font, TextFormat("All %d levels OK", total), pos, fontSize, 1, {120, 200, 120, 255});
+        return;
+    }
+    DrawTextEx(font, TextFormat("%d broken level(s):", static_cast<int>(invalid.size())), pos, fontSize, 1, selectedColor);
+    for (size_t i = 0; i < invalid.size() && static_cast<int>(i) < maxListed; i++) {
+        int levelIndex = invalid[i];
+        const LevelReport *report = LevelValidator::GetReport(levelIndex);
+        std::string line = std::to_string(levelIndex + 1) + ". " + LevelLoader::GetLevelName(levelIndex) + ": " +
+            LevelValidator::GetStatusName(LevelValidator::GetStatus(levelIndex));
+        if (report && !report->detail.empty())
+            line += " (" + report->detail + ")";
+        pos.y += fontSize + 4;
+        DrawTextEx(font, line.c_str(), pos, fontSize, 1, normalColor);
+    }
+    if (static_cast<int>(invalid.size()) > maxListed) {
+        pos.y += fontSize + 4;
+        DrawTextEx(font, TextFormat("...and %d more", static_cast<int>(invalid.size()) - maxListed), pos, fontSize, 1,
+            normalColor);
+    }
+}
+
+void MenuScreen::OpenLevelSelect()
+{
+    levelSelectOpen = true;
+    levelSelection = std::clamp(levelSelection, 0, std::max(0, LevelIndex::GetCount() - 1));
+    needsRedraw = true;
+}
+
+int MenuScreen::TakeChosenLevel()
+{
+    int level = chosenLevel;
+    chosenLevel = -1;
+    return level;
+}
+
+void MenuScreen::UpdateLevelSelect()
+{
+    int count = LevelIndex::GetCount();
+    int previous = levelSelection;
+    if (IsKeyPressed(KEY_BACKSPACE)) {
+        levelSelectOpen = false;
+        needsRedraw = true;
+        return;
+    }
+    if (count == 0)
+        return;
+    if (IsKeyPressed(KEY_UP) || IsKeyPressedRepeat(KEY_UP) || IsKeyPressed(KEY_W))
+        levelSelection--;
+    if (IsKeyPressed(KEY_DOWN) || IsKeyPressedRepeat(KEY_DOWN) || IsKeyPressed(KEY_S))
+        levelSelection++;
+    if (IsKeyPressed(KEY_PAGE_UP) || IsKeyPressedRepeat(KEY_PAGE_UP))
+        levelSelection -= LEVEL_ROWS;
+    if (IsKeyPressed(KEY_PAGE_DOWN) || IsKeyPressedRepeat(KEY_PAGE_DOWN))
+        levelSelection += LEVEL_ROWS;
+    levelSelection = std::clamp(levelSelection, 0, count - 1);
+    if (levelSelection != previous)
+        needsRedraw = true;
+    if (IsKeyPressed(KEY_ENTER) || IsKeyPressed(KEY_SPACE)) {
+        chosenLevel = levelSelection;
+        levelSelectOpen = false;
+        needsRedraw = true;
+    }
+}
+
+void MenuScreen::DrawLevelSelect()
+{
+    // Everything shown here comes from the level index; no level file is
+    // opened while browsing
+    const int fontSize = 22;
+    const float rowHeight = fontSize + 8.0f;
+    int count = LevelIndex::GetCount();
+    float left = GetScreenWidth() * 0.2f;
+    float top = menuStartPos.y - 40.0f;
+    if (count == 0) {
+        DrawTextEx(font, "No levels found", {left, top}, fontSize, 1, normalColor);
+        return;
+    }
+    int first = std::clamp(levelSelection - LEVEL_ROWS / 2, 0, std::max(0, count - LEVEL_ROWS));
+    int last = std::min(count, first + LEVEL_ROWS);
+    for (int i = first; i < last; i++) {
+        const LevelMeta *meta = LevelIndex::GetEntry(i);
+        std::string best = (meta->bestMoves >= 0) ? std::to_string(meta->bestMoves) + " moves" : "-";
+        std::string line = TextFormat("%4d. %s", i + 1, meta->name.c_str());
+        std::string details = TextFormat("%dx%d  %d box(es)  best: %s", meta->width, meta->height,
+            meta->boxCount, best.c_str());
+        LevelStatus status = LevelValidator::GetStatus(i);
+        bool broken = status != LevelStatus::OK && status != LevelStatus::PENDING;
+        Vector2 rowPos = {left, top + (i - first) * rowHeight};
+        if (i == levelSelection)
+            DrawRectangle(rowPos.x - 10, rowPos.y - 4, GetScreenWidth() * 0.6f + 20, rowHeight, {255, 255, 255, 50});
+        Color color = (i == levelSelection) ? selectedColor : normalColor;
+        DrawTextEx(font, line.c_str(), rowPos, fontSize, 1, color);
+        if (broken)
+            details += "  [" + std::string(LevelValidator::GetStatusName(status)) + "]";
+        DrawTextEx(font, details.c_str(), {left + GetScreenWidth() * 0.3f, rowPos.y}, fontSize, 1,
+            broken ? Color{255, 140, 120, 255} : color);
+    }
+}
+
 void MenuScreen::MoveUp() {
+    needsRedraw = true;
     selectedOption--;
     if (selectedOption < 0) {
         selectedOption = static_cast<int>(menuItems.size()) - 1;
@@ -201,6 +342,7 @@ void MenuScreen::MoveUp() {
 }
 
 void MenuScreen::MoveDown() {
+    needsRedraw = true;
     selectedOption++;
     if (selectedOption >= static_cast<int>(menuItems.size())) {
         selectedOption = 0;
@@ -229,8 +371,11 @@ void MenuScreen::StopBackgroundMusic() {
 
 void MenuScreen::Reset() {
     selectedOption = 0;
+    levelSelectOpen = false;
+    chosenLevel = -1;
     titleAnimation = 0.0f;
     menuAnimation = 0.0f;
     backgroundRotation = 0.0f;
     inputCooldown = 0.0f;
+    needsRedraw = true;
 }
\ No newline at end of file
@@ -39,6 +39,12 @@ private:
     Vector2 menuStartPos;
     float menuSpacing;
     float inputCooldown;
+    bool needsRedraw;
+    int validatedLevels;
+    bool levelSelectOpen;
+    int levelSelection;
+    int chosenLevel;
+    const int LEVEL_ROWS = 10;
     const float INPUT_DELAY = 0.15f;
     void InitializeMenuItems();
     void CalculatePositions();
@@ -47,6 +53,9 @@ private:
     void DrawTitle();
     void DrawMenuItems();
     void DrawFooter();
+    void DrawLevelStatus();
+    void UpdateLevelSelect();
+    void DrawLevelSelect();
 
 public:
     MenuScreen();
@@ -62,6 +71,10 @@ public:
     void PlayBackgroundMusic();
     void StopBackgroundMusic();
     void Reset();
+    void OpenLevelSelect();
+    bool IsLevelSelectOpen() const { return levelSelectOpen; }
+    int TakeChosenLevel();
+    bool NeedsRedraw() const { return needsRedraw; }
 };
 
 #endif /* !MENUSCREEN_HPP_ */
\ No newline at end of file
@@ -18,6 +18,7 @@ PauseScreen::PauseScreen() :
     overlayAlpha(0.0f),
     targetAlpha(180.0f),
     inputCooldown(0.0f),
+    needsRedraw(true),
     titlePos({0}),
     menuStartPos({0}),
     menuSpacing(50.0f),
@@ -91,6 +92,7 @@ void PauseScreen::Update(float deltaTime)
         }
         else if (IsKeyPressed(KEY_ESCAPE)) {
             selectedOption = 0;
+            needsRedraw = true;
             inputCooldown = INPUT_DELAY;
         }
     }
@@ -99,6 +101,8 @@ void PauseScreen::Update(float deltaTime)
 void PauseScreen::UpdateAnimations(float deltaTime)
 {
     menuAnimation += deltaTime * 2.0f;
+    if ((isVisible && overlayAlpha < targetAlpha) || (!isVisible && overlayAlpha > 0))
+        needsRedraw = true;
     if (isVisible && overlayAlpha < targetAlpha) {
         overlayAlpha += deltaTime * 400.0f;
         if (overlayAlpha > targetAlpha) {
@@ -116,6 +120,7 @@ void PauseScreen::UpdateAnimations(float deltaTime)
 
 void PauseScreen::Draw()
 {
+    needsRedraw = false;
     if (!isVisible && overlayAlpha <= 0)
         return;
     DrawOverlay();
@@ -226,6 +231,7 @@ void PauseScreen::Hide()
 
 void PauseScreen::MoveUp()
 {
+    needsRedraw = true;
     selectedOption--;
     if (selectedOption < 0) {
         selectedOption = static_cast<int>(menuItems.size()) - 1;
@@ -234,6 +240,7 @@ void PauseScreen::MoveUp()
 
 void PauseScreen::MoveDown()
 {
+    needsRedraw = true;
     selectedOption++;
     if (selectedOption >= static_cast<int>(menuItems.size())) {
         selectedOption = 0;
@@ -254,5 +261,6 @@ void PauseScreen::Reset() {
     selectedOption = 0;
     menuAnimation = 0.0f;
     inputCooldown = 0.0f;
+    needsRedraw = true;
     CalculatePositions();
 }
\ No newline at end of file
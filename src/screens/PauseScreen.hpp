@@ -28,6 +28,7 @@ private:
     float overlayAlpha;
     float targetAlpha;
     float inputCooldown;
+    bool needsRedraw;
     Vector2 titlePos;
     Vector2 menuStartPos;
     float menuSpacing;
@@ -53,6 +54,7 @@ public:
     void Show();
     void Hide();
     bool IsVisible() const { return isVisible; }
+    bool NeedsRedraw() const { return needsRedraw; }
     void MoveUp();
     void MoveDown();
     PauseOption GetSelectedOption() const;
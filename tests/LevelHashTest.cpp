@@ -0,0 +1,98 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelHashTest
+*/
+
+#include "level/Level.hpp"
+#include <iostream>
+#include <string>
+
+static int failures = 0;
+
+static void Check(bool condition, const char *what)
+{
+    if (!condition) {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+// A wall splits the level into a left and a right region
+static const char *SPLIT_LEVEL = R"({
+    "name": "Split",
+    "width": 9,
+    "height": 5,
+    "playerStart": {"x": 1, "y": 1},
+    "grid": [
+        "#########",
+        "#  #    #",
+        "# $#  . #",
+        "#  #    #",
+        "#########"
+    ]
+})";
+
+// The box is the only thing separating the two halves of the corridor
+static const char *CORRIDOR_LEVEL = R"({
+    "name": "Corridor",
+    "width": 7,
+    "height": 3,
+    "playerStart": {"x": 1, "y": 1},
+    "grid": [
+        "#######",
+        "#  $ .#",
+        "#######"
+    ]
+})";
+
+static void TestRegions()
+{
+    Level level;
+    if (!level.LoadFromJSON(SPLIT_LEVEL)) {
+        Check(false, "split level loads");
+        return;
+    }
+    Check(level.GetNormalizedStateHash({1, 1}) == level.GetNormalizedStateHash({2, 3}),
+          "same region hashes equal");
+    Check(level.GetNormalizedStateHash({5, 1}) == level.GetNormalizedStateHash({7, 3}),
+          "same region hashes equal on the other side");
+    Check(level.GetNormalizedStateHash({1, 1}) != level.GetNormalizedStateHash({5, 1}),
+          "different regions hash differently");
+    Check(level.GetStateHash({1, 1}) != level.GetStateHash({2, 3}), "exact hash keeps the player cell");
+    GridPos canonical = level.NormalizePlayerPosition({2, 3});
+    Check(canonical.x == 1 && canonical.y == 1, "canonical cell is the smallest reachable index");
+}
+
+static void TestBoxMoves()
+{
+    Level level;
+    if (!level.LoadFromJSON(CORRIDOR_LEVEL)) {
+        Check(false, "corridor level loads");
+        return;
+    }
+    uint64_t start = level.GetNormalizedStateHash({1, 1});
+    Check(start != level.GetNormalizedStateHash({5, 1}), "box splits the corridor");
+    level.MoveBox({3, 1}, {4, 1});
+    Check(level.GetNormalizedStateHash({1, 1}) != start, "pushing a box changes the hash");
+    Check(level.GetNormalizedStateHash({1, 1}) == level.GetNormalizedStateHash({3, 1}),
+          "pushed box widens the region");
+    level.MoveBox({4, 1}, {3, 1});
+    Check(level.GetNormalizedStateHash({2, 1}) == start, "pushing back restores the hash");
+    level.RemoveBox(3, 1);
+    Check(level.GetNormalizedStateHash({1, 1}) == level.GetNormalizedStateHash({5, 1}),
+          "removing the box joins the regions");
+}
+
+int main()
+{
+    TestRegions();
+    TestBoxMoves();
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+    std::cout << "All level hash checks passed" << std::endl;
+    return 0;
+}
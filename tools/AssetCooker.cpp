@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** AssetCooker
+*/
+
+#include "core/CookedAssets.hpp"
+#include "graphics/TextureBaker.hpp"
+#include "level/LevelLoader.hpp"
+#include "level/LevelPack.hpp"
+#include <raylib.h>
+#include <deque>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+static bool CookLevels(const std::string &sourceDir, const std::string &outputDir)
+{
+    if (!LevelLoader::LoadLevelList(sourceDir + "/levels/")) {
+        std::cerr << "No levels found in " << sourceDir << "/levels/" << std::endl;
+        return false;
+    }
+    std::deque<Level> levels;
+    std::vector<const Level *> packed;
+    std::vector<std::string> levelSources;
+    // The directory itself is stamped too, so added or removed files also
+    // make the pack stale
+    std::vector<std::string> sourceFiles = {sourceDir + "/levels/"};
+    for (int i = 0; i < LevelLoader::GetTotalLevels(); ++i) {
+        if (LevelLoader::GetLevelPath(i) != sourceFiles.back())
+            sourceFiles.push_back(LevelLoader::GetLevelPath(i));
+        levels.emplace_back();
+        if (!LevelLoader::LoadLevel(levels.back(), i)) {
+            std::cerr << "Skipping unloadable level: " << LevelLoader::GetLevelFileName(i) << std::endl;
+            levels.pop_back();
+            continue;
+        }
+        packed.push_back(&levels.back());
+        levelSources.push_back(LevelLoader::GetLevelFileName(i));
+    }
+    std::string output = outputDir + "/" + CookedAssets::LEVEL_PACK;
+    if (!LevelPack::Write(output, packed, levelSources, sourceFiles))
+        return false;
+    std::cout << "Cooked " << packed.size() << " level(s) into " << output << std::endl;
+    return true;
+}
+
+static bool CookAtlas(const std::string &outputDir)
+{
+    Image atlas = TextureBaker::BakeTileAtlas();
+    ImageMipmaps(&atlas);
+    std::string output = outputDir + "/" + CookedAssets::TILE_ATLAS;
+    bool written = CookedAssets::WriteImage(output, atlas);
+    if (written)
+        std::cout << "Cooked tile atlas (" << atlas.width << "x" << atlas.height << ", "
+                  << atlas.mipmaps << " mip levels) into " << output << std::endl;
+    UnloadImage(atlas);
+    return written;
+}
+
+static bool CookSound(const std::string &sourceDir, const std::string &outputDir, const std::string &name)
+{
+    std::string source = sourceDir + "/sounds/" + name + ".wav";
+    if (!FileExists(source.c_str())) {
+        std::cout << "Skipping missing sound: " << source << std::endl;
+        return true;
+    }
+    Wave wave = LoadWave(source.c_str());
+    if (!wave.data) {
+        std::cerr << "Could not decode sound: " << source << std::endl;
+        return false;
+    }
+    std::string output = outputDir + "/" + name + ".pcm";
+    bool written = CookedAssets::WriteWave(output, wave);
+    if (written)
+        std::cout << "Cooked " << source << " into " << output << std::endl;
+    UnloadWave(wave);
+    return written;
+}
+
+static bool CookMusic(const std::string &sourceDir, const std::string &outputDir)
+{
+    // Music stays streamed, but from uncompressed WAV so no MP3 decoding
+    // happens while the menu is up
+    std::string source = sourceDir + "/sounds/menu_music.mp3";
+    if (!FileExists(source.c_str())) {
+        std::cout << "Skipping missing music: " << source << std::endl;
+        return true;
+    }
+    Wave wave = LoadWave(source.c_str());
+    if (!wave.data) {
+        std::cerr << "Could not decode music: " << source << std::endl;
+        return false;
+    }
+    std::string output = outputDir + "/menu_music.wav";
+    bool written = ExportWave(wave, output.c_str());
+    if (written)
+        std::cout << "Cooked " << source << " into " << output << std::endl;
+    UnloadWave(wave);
+    return written;
+}
+
+int main(int argc, char **argv)
+{
+    std::string sourceDir = (argc > 1) ? argv[1] : "assets";
+    std::string outputDir = (argc > 2) ? argv[2] : "assets/cooked";
+    SetTraceLogLevel(LOG_WARNING);
+    std::filesystem::create_directories(outputDir);
+    bool ok = CookLevels(sourceDir, outputDir);
+    ok = CookAtlas(outputDir) && ok;
+    for (const char *name : {"move", "push", "complete"})
+        ok = CookSound(sourceDir, outputDir, name) && ok;
+    ok = CookMusic(sourceDir, outputDir) && ok;
+    if (!ok) {
+        std::cerr << "Asset cooking finished with errors" << std::endl;
+        return 1;
+    }
+    std::cout << "Assets cooked into " << outputDir << std::endl;
+    return 0;
+}
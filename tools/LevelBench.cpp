@@ -0,0 +1,109 @@
+/*
+** EPITECH PROJECT, 2025
+** sokoban3D
+** File description:
+** LevelBench
+*/
+
+#include "level/Level.hpp"
+#include "level/LevelParser.hpp"
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct BenchInput {
+    std::string name;
+    std::string content;
+};
+
+static std::string MakeSyntheticLevel(int size)
+{
+    std::string json = "{\n    \"name\": \"Synthetic " + std::to_string(size) + "\",\n";
+    json += "    \"width\": " + std::to_string(size) + ",\n";
+    json += "    \"height\": " + std::to_string(size) + ",\n";
+    json += "    \"playerStart\": {\"x\": 1, \"y\": 1},\n    \"grid\": [\n";
+    for (int y = 0; y < size; ++y) {
+        std::string row(size, ' ');
+        for (int x = 0; x < size; ++x) {
+            if (x == 0 || y == 0 || x == size - 1 || y == size - 1)
+                row[x] = '#';
+            else if ((x * 7 + y * 13) % 97 == 0)
+                row[x] = '$';
+            else if ((x * 11 + y * 5) % 97 == 0)
+                row[x] = '.';
+        }
+        json += "        \"" + row + "\"";
+        json += (y + 1 < size) ? ",\n" : "\n";
+    }
+    json += "    ]\n}\n";
+    return json;
+}
+
+static double Seconds(std::chrono::steady_clock::duration duration)
+{
+    return std::chrono::duration<double>(duration).count();
+}
+
+static void RunBench(const std::vector<BenchInput> &inputs, int iterations)
+{
+    size_t totalBytes = 0;
+    for (const auto &input : inputs)
+        totalBytes += input.content.size();
+    size_t failures = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (const auto &input : inputs) {
+            LevelSource source;
+            LevelParser parser(input.content);
+            if (!parser.Parse(source))
+                failures++;
+        }
+    }
+    double parseTime = Seconds(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        for (const auto &input : inputs) {
+            Level level;
+            level.LoadFromJSON(input.content);
+        }
+    }
+    double loadTime = Seconds(std::chrono::steady_clock::now() - start);
+
+    double megabytes = static_cast<double>(totalBytes) * iterations / (1024.0 * 1024.0);
+    double levels = static_cast<double>(inputs.size()) * iterations;
+    std::cout << "  parse: " << megabytes / parseTime << " MB/s, "
+              << levels / parseTime << " levels/s" << std::endl;
+    std::cout << "  load:  " << megabytes / loadTime << " MB/s, "
+              << levels / loadTime << " levels/s" << std::endl;
+    if (failures > 0)
+        std::cout << "  " << failures / iterations << " input(s) failed to parse" << std::endl;
+}
+
+int main(int argc, char **argv)
+{
+    std::string directory = (argc > 1) ? argv[1] : "assets/levels";
+    int iterations = (argc > 2) ? std::stoi(argv[2]) : 200;
+    std::vector<BenchInput> inputs;
+    if (std::filesystem::is_directory(directory)) {
+        for (const auto &entry : std::filesystem::directory_iterator(directory)) {
+            if (entry.path().extension() != ".json")
+                continue;
+            BenchInput input;
+            input.name = entry.path().string();
+            if (LevelParser::ReadFile(input.name, input.content))
+                inputs.push_back(std::move(input));
+        }
+    }
+    if (!inputs.empty()) {
+        std::cout << inputs.size() << " level file(s) from " << directory
+                  << ", " << iterations << " iteration(s)" << std::endl;
+        RunBench(inputs, iterations);
+    }
+    std::vector<BenchInput> synthetic = {{"synthetic", MakeSyntheticLevel(1024)}};
+    std::cout << "Synthetic 1024x1024 level (" << synthetic[0].content.size() / 1024 << " KB), 5 iteration(s)" << std::endl;
+    RunBench(synthetic, 5);
+    return 0;
+}